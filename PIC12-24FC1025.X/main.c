@@ -33,12 +33,15 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      07/27/14    Initial version
+ * 1.1      10/19/26    delay_ms() with Timer2
+ * 1.2      10/19/26    delay_ms() moved to pic12f1840_delay.c
  *********************************************************************/
 
 /** INCLUDES *******************************************************/
 #include "pic12f1840_cbits.h"  // Apropiate configuration bits header
 #include "main.h"
 #include "pic12f1840_i2c.h"
+#include "pic12f1840_delay.h"
 #include "mcp23017.h"
 #include "m24fc1025.h"
 
@@ -46,7 +49,6 @@
 
 /** PROTOTYPES *****************************************************/
 #define SetClockTo32Mhz()  OSCCONbits.IRCF = 0b1110; OSCCONbits.SPLLEN = 1
-void delay_ms(uint16_t);
 
 /** GLOBAL VARIABLES ***********************************************/
 
@@ -93,9 +95,3 @@ void main(void) {
         }
     }
 }
-
-void delay_ms(uint16_t t_ms) {
-    for (t_ms; t_ms > 0; t_ms--) {
-        for (uint16_t c = 886; c > 0; c--);
-    }
-}
\ No newline at end of file
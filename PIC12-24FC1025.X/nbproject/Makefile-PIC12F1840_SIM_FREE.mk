@@ -45,17 +45,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=main.c pic12f1840_i2c.c mcp23017.c m24fc1025.c
+SOURCEFILES_QUOTED_IF_SPACED=main.c pic12f1840_i2c.c mcp23017.c m24fc1025.c pic12f1840_delay.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.p1 ${OBJECTDIR}/pic12f1840_i2c.p1 ${OBJECTDIR}/mcp23017.p1 ${OBJECTDIR}/m24fc1025.p1
-POSSIBLE_DEPFILES=${OBJECTDIR}/main.p1.d ${OBJECTDIR}/pic12f1840_i2c.p1.d ${OBJECTDIR}/mcp23017.p1.d ${OBJECTDIR}/m24fc1025.p1.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.p1 ${OBJECTDIR}/pic12f1840_i2c.p1 ${OBJECTDIR}/mcp23017.p1 ${OBJECTDIR}/m24fc1025.p1 ${OBJECTDIR}/pic12f1840_delay.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/main.p1.d ${OBJECTDIR}/pic12f1840_i2c.p1.d ${OBJECTDIR}/mcp23017.p1.d ${OBJECTDIR}/m24fc1025.p1.d ${OBJECTDIR}/pic12f1840_delay.p1.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/main.p1 ${OBJECTDIR}/pic12f1840_i2c.p1 ${OBJECTDIR}/mcp23017.p1 ${OBJECTDIR}/m24fc1025.p1
+OBJECTFILES=${OBJECTDIR}/main.p1 ${OBJECTDIR}/pic12f1840_i2c.p1 ${OBJECTDIR}/mcp23017.p1 ${OBJECTDIR}/m24fc1025.p1 ${OBJECTDIR}/pic12f1840_delay.p1
 
 # Source Files
-SOURCEFILES=main.c pic12f1840_i2c.c mcp23017.c m24fc1025.c
+SOURCEFILES=main.c pic12f1840_i2c.c mcp23017.c m24fc1025.c pic12f1840_delay.c
 
 
 CFLAGS=
@@ -110,6 +110,14 @@ ${OBJECTDIR}/m24fc1025.p1: m24fc1025.c  nbproject/Makefile-${CND_CONF}.mk
 	@-${MV} ${OBJECTDIR}/m24fc1025.d ${OBJECTDIR}/m24fc1025.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/m24fc1025.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/pic12f1840_delay.p1: pic12f1840_delay.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR} 
+	@${RM} ${OBJECTDIR}/pic12f1840_delay.p1.d 
+	@${RM} ${OBJECTDIR}/pic12f1840_delay.p1 
+	${MP_CC} --pass1 $(MP_EXTRA_CC_PRE) --chip=$(MP_PROCESSOR_OPTION) -Q -G  -D__DEBUG=1 --debugger=none  --double=32 --float=32 --opt=default,+asm,+asmfile,-speed,+space,-debug --addrqual=ignore --mode=free -P -N255 --warn=0 --cci --asmlist --summary=default,-psect,-class,+mem,-hex,-file --output=default,-inhx032 --runtime=default,+clear,+init,-keep,-no_startup,+osccal,-resetbits,-download,-stackcall,+clib --output=-mcof,+elf:multilocs --stack=compiled:auto:auto "--errformat=%f:%l: error: (%n) %s" "--warnformat=%f:%l: warning: (%n) %s" "--msgformat=%f:%l: advisory: (%n) %s"    -o${OBJECTDIR}/pic12f1840_delay.p1  pic12f1840_delay.c 
+	@-${MV} ${OBJECTDIR}/pic12f1840_delay.d ${OBJECTDIR}/pic12f1840_delay.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/pic12f1840_delay.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 else
 ${OBJECTDIR}/main.p1: main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR} 
@@ -143,6 +151,14 @@ ${OBJECTDIR}/m24fc1025.p1: m24fc1025.c  nbproject/Makefile-${CND_CONF}.mk
 	@-${MV} ${OBJECTDIR}/m24fc1025.d ${OBJECTDIR}/m24fc1025.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/m24fc1025.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/pic12f1840_delay.p1: pic12f1840_delay.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR} 
+	@${RM} ${OBJECTDIR}/pic12f1840_delay.p1.d 
+	@${RM} ${OBJECTDIR}/pic12f1840_delay.p1 
+	${MP_CC} --pass1 $(MP_EXTRA_CC_PRE) --chip=$(MP_PROCESSOR_OPTION) -Q -G  --double=32 --float=32 --opt=default,+asm,+asmfile,-speed,+space,-debug --addrqual=ignore --mode=free -P -N255 --warn=0 --cci --asmlist --summary=default,-psect,-class,+mem,-hex,-file --output=default,-inhx032 --runtime=default,+clear,+init,-keep,-no_startup,+osccal,-resetbits,-download,-stackcall,+clib --output=-mcof,+elf:multilocs --stack=compiled:auto:auto "--errformat=%f:%l: error: (%n) %s" "--warnformat=%f:%l: warning: (%n) %s" "--msgformat=%f:%l: advisory: (%n) %s"    -o${OBJECTDIR}/pic12f1840_delay.p1  pic12f1840_delay.c 
+	@-${MV} ${OBJECTDIR}/pic12f1840_delay.d ${OBJECTDIR}/pic12f1840_delay.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/pic12f1840_delay.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -0,0 +1,54 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       pic12f1840_delay.h
+ * Created On:      October 19, 2026, 7:10 PM
+ * Description:     Millisecond delays counted by Timer2 (Fosc/4, 1:64),
+ *                  the same in any build. Timer2 stops in sleep and the
+ *                  PIC12F1840 has no idle mode, so the period flag is
+ *                  polled. Same copy in every project, like the I2C
+ *                  driver. Timer2 is free after the delay.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version, from main.c
+ *********************************************************************/
+
+#ifndef __PIC12F1840_DELAY_H
+#define __PIC12F1840_DELAY_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Wait some milliseconds (Blocking, uses Timer2)
+ * @param t_ms Milliseconds
+ */
+void delay_ms(uint16_t t_ms);
+
+#endif // __PIC12F1840_DELAY_H
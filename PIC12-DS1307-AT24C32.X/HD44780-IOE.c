@@ -26,70 +26,243 @@
          08/04/2014
         - Updated to XC8
         - Changed to be use with MCP23017 I/O Expander on IOA instead of STP
+        10/19/2026
+        - Nibbles are streamed to IOA in one I2C burst per command/string
+        - Added shadow framebuffer (lcd_fb_*) with dirty cell flush
+        - Added LCD_RW_MODE busy flag polling for clear/home
+        - Added LCD_INTERFACE_8BIT, data on IOA and control pins on IOB
+        - Added command queue drained by lcd_task() (LCD_QUEUE_SIZE)
+        - Added CGRAM glyph manager lcd_glyph() with LRU slots
+        - Added 3x2 big digits lcd_fb_big_digit(), lcd_fb_big_digit_load()
+        - IOCON is read-modify-write, the keypad sets INTB open drain
  **/
 
 #include "HD44780-IOE.h"
 #include "mcp23017.h"
 
 // private function prototypes
-static void _send_nibble(unsigned char);
+static void _burst_put(void);
+static void _burst_end(void);
 static void _send_byte(unsigned char);
+static void _set_rs(bool);
+static void _send(bool, unsigned char);
+static void _put(bool, unsigned char);
+static bool _room(unsigned char);
+#if !LCD_INTERFACE_8BIT
+static void _send_nibble(unsigned char);
 static void _set_4bit_interface();
+#endif
+static unsigned char _line_addr(unsigned char);
 
 // global variables
 unsigned char display_config[6];
+static bool g_burst_open; // MCP23017 burst transaction in progress
+
+#if LCD_GLYPHS
+static const unsigned char *g_glyph_slot[8]; // Pattern loaded on each CGRAM slot
+static uint8_t g_glyph_lru[8]; // CGRAM slots, most recently used first
+#endif
+
+#if LCD_BIG_DIGITS
+// Big digit segments
+static const unsigned char g_big_glyphs[8][8] = {
+    {0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, // 0 = Upper left
+    {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00}, // 1 = Upper bar
+    {0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, // 2 = Upper right
+    {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x07}, // 3 = Lower left
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F}, // 4 = Lower bar
+    {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C}, // 5 = Lower right
+    {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F}, // 6 = Upper + middle bar
+    {0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F} // 7 = Middle + lower bar
+};
+// Cells of every digit |top 3|bottom 3|, 0-7 = segment, else ROM character
+#define BIG_SP  ' '
+#define BIG_FB  0xFF // Full block
+static const unsigned char g_big_digits[10][6] = {
+    {0, 1, 2, 3, 4, 5}, // 0
+    {1, 2, BIG_SP, 4, BIG_FB, 4}, // 1
+    {6, 6, 2, 3, 7, 7}, // 2
+    {6, 6, 2, 7, 7, 5}, // 3
+    {3, 4, BIG_FB, BIG_SP, BIG_SP, BIG_FB}, // 4
+    {BIG_FB, 6, 6, 7, 7, 5}, // 5
+    {0, 6, 6, 3, 7, 5}, // 6
+    {1, 1, 2, BIG_SP, BIG_SP, BIG_FB}, // 7
+    {0, 6, 2, 3, 7, 5}, // 8
+    {0, 6, 2, BIG_SP, BIG_SP, BIG_FB} // 9
+};
+#endif
+
+#if LCD_QUEUE_SIZE > 0
+#define QUEUE_MASK (LCD_QUEUE_SIZE - 1)
+static uint8_t g_queue[LCD_QUEUE_SIZE]; // command/data bytes
+static uint8_t g_queue_rs[(LCD_QUEUE_SIZE + 7) / 8]; // RS bit of every entry
+static volatile uint8_t g_queue_head; // written by lcd_*() (producer)
+static volatile uint8_t g_queue_tail; // written by lcd_task() (consumer)
+static bool g_queue_on; // false while lcd_initialize() writes directly
+static volatile bool g_queue_bl; // backlight state for lcd_task()
+#endif
+
+#if LCD_FRAMEBUFFER
+#define FB_DIRTY_BYTES ((LCD_CHARACTERS + 7) / 8)
+static char g_fb[LCD_LINES][LCD_CHARACTERS]; // what the LCD should show
+static uint8_t g_fb_dirty[LCD_LINES][FB_DIRTY_BYTES]; // 1 bit per cell
+static unsigned char g_fb_row, g_fb_col; // draw position (0 based)
+#endif
 
 // Declaration of STPByte (will be the LCD Register)
 
-union IOAByte {
+union LCDPortByte {
     uint8_t LCD_DATA;
 
     struct {
-        unsigned A0 : 1; //A0-LSB
-        unsigned A1 : 1; //A1
-        unsigned A2 : 1; //A2
-        unsigned A3 : 1; //A3
-        unsigned A4 : 1; //A4
-        unsigned A5 : 1; //A5
-        unsigned A6 : 1; //A6
-        unsigned A7 : 1; //A7-MSB
+        unsigned P0 : 1; //P0-LSB
+        unsigned P1 : 1; //P1
+        unsigned P2 : 1; //P2
+        unsigned P3 : 1; //P3
+        unsigned P4 : 1; //P4
+        unsigned P5 : 1; //P5
+        unsigned P6 : 1; //P6
+        unsigned P7 : 1; //P7-MSB
     };
-} LCDPort;
+} LCDPort; // Control pins (and data pins in 4-bit mode)
+
+#if LCD_INTERFACE_8BIT
+#define LCD_CTRL_REG    MCP23017_REG_GPIOB
+#define LCD_DATA_IODIR  0xFF // D0-D7 as inputs
+static uint8_t g_lcd_data; // D0-D7 on IOA
+#else
+#define LCD_CTRL_REG    MCP23017_REG_GPIOA
+#define LCD_DATA_IODIR  DATA_MASK // D4-D7 as inputs
+#endif
 
-static void mcp23017_ioa_send_byte(void) {
-    mcp23017_write_reg(MCP23017_REG_GPIOA, LCDPort.LCD_DATA);
+static void _ctrl_send_byte(void) {
+    mcp23017_write_reg(LCD_CTRL_REG, LCDPort.LCD_DATA);
 }
 
 // private utility functions
 
+static void _burst_put(void) {
+    // Open the transaction on the first write, then every port value
+    // goes out as |GPIOA|GPIOB| (byte mode toggles the register pair)
+    if (!g_burst_open) {
+        mcp23017_burst_start(MCP23017_REG_GPIOA);
+        g_burst_open = true;
+    }
+#if LCD_INTERFACE_8BIT
+    mcp23017_burst_write(g_lcd_data);
+    mcp23017_burst_write(LCDPort.LCD_DATA);
+#else
+    mcp23017_burst_write(LCDPort.LCD_DATA);
+    mcp23017_burst_write(LCD_BURST_PAD);
+#endif
+}
+
+static void _burst_end(void) {
+    if (g_burst_open) {
+        mcp23017_burst_stop();
+        g_burst_open = false;
+    }
+}
+
+#if LCD_INTERFACE_8BIT
+static void _send_byte(unsigned char data) {
+    g_lcd_data = data;
+
+    // |DATA+EN=1|DATA+EN=0|, data is latched on the falling edge of EN
+    LCDPort.LCD_EN = 1;
+    _burst_put();
+    LCDPort.LCD_EN = 0;
+    _burst_put();
+}
+#else
 static void _send_nibble(unsigned char data) {
 #if DATA_SHIFT > 0
     data <<= DATA_SHIFT; // shift the data as required
 #endif
     LCDPort.LCD_DATA &= ~DATA_MASK; // clear old data bits
     LCDPort.LCD_DATA |= DATA_MASK & data; // put in new data bits
-    mcp23017_ioa_send_byte();
 
+    // |DATA+EN=1|DATA+EN=0|, data is latched on the falling edge of EN
     LCDPort.LCD_EN = 1;
-    mcp23017_ioa_send_byte();
-    LCD_ENABLE_PULSE_DELAY();
+    _burst_put();
     LCDPort.LCD_EN = 0;
-    mcp23017_ioa_send_byte();
-    LCD_ENABLE_PULSE_DELAY();
+    _burst_put();
 }
 
 static void _send_byte(unsigned char data) {
     _send_nibble(data >> 4);
     _send_nibble(data & 0x0F);
 }
+#endif
+
+static void _set_rs(bool rs) {
+    // RS must be stable before EN goes high, only costs a write on change
+    if (LCDPort.LCD_RS != rs) {
+        LCDPort.LCD_RS = rs;
+        _burst_put();
+    }
+}
 
+static void _send(bool rs, unsigned char value) {
+    _set_rs(rs);
+    _send_byte(value);
+    if ((rs == 0) && (value < ENTRY_MODE)) {
+        // Clear/home are slow, they must end the burst and wait
+        _burst_end();
+        LCD_HOME_CLEAR_DELAY();
+    }
+}
+
+static void _put(bool rs, unsigned char value) {
+#if LCD_QUEUE_SIZE > 0
+    uint8_t head;
+
+    if (g_queue_on) {
+        head = g_queue_head;
+        while (((head + 1) & QUEUE_MASK) == g_queue_tail) {
+            // Full, make room now instead of losing a command argument
+            // or the tail of a string
+            lcd_task();
+        }
+        g_queue[head] = value;
+        if (rs)
+            g_queue_rs[head >> 3] |= (uint8_t) (1 << (head & 0x07));
+        else
+            g_queue_rs[head >> 3] &= (uint8_t) ~(1 << (head & 0x07));
+        g_queue_head = (head + 1) & QUEUE_MASK;
+        return;
+    }
+#endif
+    _send(rs, value);
+}
+
+static bool _room(unsigned char entries) {
+#if LCD_QUEUE_SIZE > 0
+    if (g_queue_on)
+        return (lcd_queue_free() >= entries);
+#endif
+    return true;
+}
+
+#if !LCD_INTERFACE_8BIT
 static void _set_4bit_interface() {
     LCDPort.LCD_RS = 0;
-    mcp23017_ioa_send_byte();
-    LCD_ADDRESS_SETUP_DELAY();
+    _ctrl_send_byte();
     _send_nibble(0b0010);
+    _burst_end();
     LCD_EXECUTION_DELAY();
 }
+#endif
+
+static unsigned char _line_addr(unsigned char row) {
+    switch (row) {
+        case 1: return LCD_LINE1_DIR;
+        case 2: return LCD_LINE2_DIR;
+        case 3: return LCD_LINE3_DIR;
+        case 4: return LCD_LINE4_DIR;
+        default: return LCD_LINEDEF_DIR;
+    }
+}
 
 /**
  * Display string stored in RAM
@@ -101,8 +274,10 @@ static void _set_4bit_interface() {
 void lcd_write(char *str) {
     unsigned char i = 0;
 
+    // The whole string goes out in one I2C transaction
     while (str[i] != '\0')
-        lcd_data(str[i++]);
+        _put(1, str[i++]);
+    _burst_end();
 }
 
 /**
@@ -111,32 +286,87 @@ void lcd_write(char *str) {
 void lcd_goto(unsigned char row, unsigned char col) {
     unsigned char addr;
 
-    switch (row) {
-        case 1: addr = LCD_LINE1_DIR;
-            break;
-        case 2: addr = LCD_LINE2_DIR;
-            break;
-        case 3: addr = LCD_LINE3_DIR;
-            break;
-        case 4: addr = LCD_LINE4_DIR;
-            break;
-        default:addr = LCD_LINEDEF_DIR;
-            break;
-    }
-    addr += col - 1;
+    addr = _line_addr(row) + col - 1;
     lcd_command(SET_DDRAM_ADDR | addr);
 }
 
 /**
  * Add a custom character
  */
-void lcd_add_character(unsigned char addr, unsigned char * pattern) {
+void lcd_add_character(unsigned char addr, const unsigned char * pattern) {
     unsigned char i;
 
-    lcd_command(SET_CGRAM_ADDR | addr << 3);
+    if (addr >= 8)
+        return; // Only 8 CGRAM slots
+#if LCD_GLYPHS
+    g_glyph_slot[addr] = NULL; // Not owned by lcd_glyph() anymore
+#endif
+    _put(0, SET_CGRAM_ADDR | addr << 3);
     for (i = 0; i < 8; i++)
-        lcd_data(pattern[i]);
+        _put(1, pattern[i]);
+    _burst_end();
+}
+
+#if LCD_GLYPHS
+static bool _glyph_on_screen(uint8_t slot) {
+#if LCD_FRAMEBUFFER
+    unsigned char i, c;
+
+    // A replaced slot would change the cells showing it
+    for (i = 0; i < LCD_LINES * LCD_CHARACTERS; i++) {
+        c = ((char *) g_fb)[i];
+        if ((c == slot) || (c == (slot | 0x08)))
+            return true;
+    }
+#endif
+    return false;
+}
+
+/**
+ * Get the character code of a custom glyph, the pattern is uploaded to
+ * CGRAM only if it isn't loaded already (replacing the least recently
+ * used slot). Glyphs are identified by their address, so keep them const.
+ * After an upload the LCD address counter points to CGRAM, draw with
+ * lcd_fb_*() or call lcd_goto() before writing.
+ * With LCD_FRAMEBUFFER a slot still on the framebuffer is not replaced.
+ * When no slot can be replaced or the queue has no room for the upload,
+ * nothing changes and LCD_GLYPH_NONE is returned, draw it again later.
+ *
+ * Usage:
+ *     const unsigned char bell[8] = {0x04, 0x0E, 0x0E, 0x0E, 0x1F, 0x00, 0x04, 0x00};
+ *     lcd_fb_putc(lcd_glyph(bell));
+ *
+ * @return Character code (0x08-0x0F, same as CGRAM 0-7 without NULL) or LCD_GLYPH_NONE
+ */
+unsigned char lcd_glyph(const unsigned char *pattern) {
+    uint8_t i, slot;
+
+    for (i = 0; i < 8; i++) { // Loaded?
+        if (g_glyph_slot[g_glyph_lru[i]] == pattern)
+            break;
+    }
+    if (i == 8) { // Miss, replace the least recently used slot not on screen
+        do {
+            if (i == 0)
+                return LCD_GLYPH_NONE; // All of them are shown
+            i--;
+        } while (_glyph_on_screen(g_glyph_lru[i]));
+        if (!_room(9))
+            return LCD_GLYPH_NONE; // Queue full, LRU and slots unchanged
+        slot = g_glyph_lru[i];
+        lcd_add_character(slot, pattern);
+        g_glyph_slot[slot] = pattern;
+    }
+
+    // Move the slot to the front
+    slot = g_glyph_lru[i];
+    for (; i > 0; i--)
+        g_glyph_lru[i] = g_glyph_lru[i - 1];
+    g_glyph_lru[0] = slot;
+
+    return slot | 0x08;
 }
+#endif
 
 /**
  * Lousy function for automatic LCD initialization
@@ -148,18 +378,36 @@ void lcd_initialize(void) {
     LCD_START_DELAY();
 
     // Initialize MCP23017
+    mcp23017_write_reg(MCP23017_REG_IOCON1,
+            mcp23017_read_reg(MCP23017_REG_IOCON1) | MCP23017_IOCON_SEQOP); // Byte mode
     mcp23017_write_reg(MCP23017_REG_IODIRA, 0x00); // IOA as output
     mcp23017_write_reg(MCP23017_REG_GPIOA, 0x00); // Clear
+#if LCD_INTERFACE_8BIT
+    mcp23017_write_reg(MCP23017_REG_IODIRB, 0x00); // IOB as output
+    mcp23017_write_reg(MCP23017_REG_GPIOB, 0x00); // Clear
+#endif
 
     // initialize the display_config
     for (i = 0; i < 6; i++) {
         display_config[i] = 0x00;
     }
 
-    _set_4bit_interface();
+#if LCD_GLYPHS
+    // CGRAM content is unknown
+    for (i = 0; i < 8; i++) {
+        g_glyph_slot[i] = NULL;
+        g_glyph_lru[i] = i;
+    }
+#endif
 
     // function set
+#if LCD_INTERFACE_8BIT
+    lcd_flags_set(FUNCTION_SET, DATA_LENGTH, 1);
+    lcd_flags_set(FUNCTION_SET, CHAR_FONT, 0);
+#else
+    _set_4bit_interface();
     lcd_flags_set(FUNCTION_SET, DATA_LENGTH | CHAR_FONT, 0);
+#endif
     lcd_flags_set(FUNCTION_SET, DISPLAY_LINES, 1);
 
     lcd_backlight_on();
@@ -172,22 +420,30 @@ void lcd_initialize(void) {
 
     lcd_clear();
     lcd_return_home();
+
+#if LCD_FRAMEBUFFER
+    // The LCD is blank now, so is the framebuffer
+    for (i = 0; i < LCD_LINES * LCD_CHARACTERS; i++)
+        ((char *) g_fb)[i] = ' ';
+    for (i = 0; i < LCD_LINES * FB_DIRTY_BYTES; i++)
+        ((uint8_t *) g_fb_dirty)[i] = 0x00;
+#endif
+
+#if LCD_QUEUE_SIZE > 0
+    // From now on lcd_*() only fill the queue
+    g_queue_bl = LCDPort.LCD_BL;
+    g_queue_on = true;
+#endif
 }
 
 void lcd_command(unsigned char command) {
-    LCDPort.LCD_RS = 0;
-    mcp23017_ioa_send_byte();
-    LCD_ADDRESS_SETUP_DELAY();
-    _send_byte(command);
-    LCD_EXECUTION_DELAY();
+    _put(0, command);
+    _burst_end();
 }
 
 void lcd_data(unsigned char data) {
-    LCDPort.LCD_RS = 1;
-    mcp23017_ioa_send_byte();
-    LCD_ADDRESS_SETUP_DELAY();
-    _send_byte(data);
-    LCD_EXECUTION_DELAY();
+    _put(1, data);
+    _burst_end();
 }
 
 void lcd_flags_set(unsigned char instruction,
@@ -225,6 +481,220 @@ void lcd_flags_set(unsigned char instruction,
 }
 
 void lcd_backlight(bool state) {
-    LCDPort.LCD_BL = state;
-    mcp23017_ioa_send_byte();
-}
\ No newline at end of file
+#if LCD_QUEUE_SIZE > 0
+    if (g_queue_on) {
+        g_queue_bl = state; // lcd_task() sends it
+        return;
+    }
+#endif
+    // Only send it when it changes
+    if (LCDPort.LCD_BL != state) {
+        LCDPort.LCD_BL = state;
+        _ctrl_send_byte();
+    }
+}
+
+#if LCD_QUEUE_SIZE > 0
+/**
+ * Free entries in the command queue
+ */
+unsigned char lcd_queue_free(void) {
+    return (g_queue_tail - g_queue_head - 1) & QUEUE_MASK;
+}
+
+/**
+ * Send queued commands/data to the LCD, call it from the main loop.
+ * At most LCD_QUEUE_DRAIN_MAX entries are sent per call in one I2C burst.
+ */
+void lcd_task(void) {
+    unsigned char n;
+    uint8_t tail;
+    bool rs;
+
+    for (n = 0; (n < LCD_QUEUE_DRAIN_MAX) && (g_queue_tail != g_queue_head); n++) {
+        tail = g_queue_tail;
+        rs = ((g_queue_rs[tail >> 3] & (uint8_t) (1 << (tail & 0x07))) != 0);
+        _send(rs, g_queue[tail]);
+        g_queue_tail = (tail + 1) & QUEUE_MASK;
+    }
+    if (LCDPort.LCD_BL != g_queue_bl) {
+        // The control port goes in the next port write
+        LCDPort.LCD_BL = g_queue_bl;
+        _burst_put();
+    }
+    _burst_end();
+}
+#endif
+
+#if LCD_RW_MODE
+/**
+ * Wait until the LCD clears the busy flag.
+ * Normal instructions finish (37 us) before the next I2C write reaches
+ * the LCD, so only the slow ones (clear/home) need to poll.
+ */
+void lcd_wait_busy(void) {
+    uint8_t status;
+    uint8_t timeout = LCD_BUSY_TIMEOUT;
+
+    // Data pins as inputs, RS = 0 and R/W = 1 to read BF + address
+    mcp23017_write_reg(MCP23017_REG_IODIRA, LCD_DATA_IODIR);
+    LCDPort.LCD_RS = 0;
+    LCDPort.LCD_RW = 1;
+    _ctrl_send_byte();
+    do {
+        LCDPort.LCD_EN = 1;
+        _ctrl_send_byte();
+        status = mcp23017_read_reg(MCP23017_REG_GPIOA);
+        LCDPort.LCD_EN = 0;
+        _ctrl_send_byte();
+#if !LCD_INTERFACE_8BIT
+        // First nibble has BF on DB7, second one (address) is discarded
+        LCDPort.LCD_EN = 1;
+        _burst_put();
+        LCDPort.LCD_EN = 0;
+        _burst_put();
+        _burst_end();
+#endif
+    } while ((status & LCD_BUSY_FLAG) && (--timeout));
+    LCDPort.LCD_RW = 0;
+    _ctrl_send_byte();
+    mcp23017_write_reg(MCP23017_REG_IODIRA, 0x00); // Data pins as outputs
+}
+#endif
+
+#if LCD_FRAMEBUFFER
+/**
+ * Fill the framebuffer with spaces (flush to show it)
+ */
+void lcd_fb_clear(void) {
+    unsigned char r, c;
+
+    for (r = 1; r <= LCD_LINES; r++) {
+        lcd_fb_goto(r, 1);
+        for (c = 0; c < LCD_CHARACTERS; c++)
+            lcd_fb_putc(' ');
+    }
+    lcd_fb_goto(1, 1);
+}
+
+/**
+ * Mark every cell as dirty, use it after the LCD was changed without
+ * the framebuffer (lcd_clear(), lcd_write(), ...)
+ */
+void lcd_fb_invalidate(void) {
+    unsigned char i;
+
+    for (i = 0; i < LCD_LINES * FB_DIRTY_BYTES; i++)
+        ((uint8_t *) g_fb_dirty)[i] = 0xFF;
+}
+
+/**
+ * Move the framebuffer draw position (same coordinates as lcd_goto())
+ */
+void lcd_fb_goto(unsigned char row, unsigned char col) {
+    g_fb_row = row - 1;
+    g_fb_col = col - 1;
+}
+
+/**
+ * Draw a character on the framebuffer and advance the draw position,
+ * only cells with a new value are marked as dirty
+ */
+void lcd_fb_putc(char c) {
+    if ((g_fb_row < LCD_LINES) && (g_fb_col < LCD_CHARACTERS)) {
+        if (g_fb[g_fb_row][g_fb_col] != c) {
+            g_fb[g_fb_row][g_fb_col] = c;
+            g_fb_dirty[g_fb_row][g_fb_col >> 3] |= (uint8_t) (1 << (g_fb_col & 0x07));
+        }
+        g_fb_col++;
+    }
+}
+
+/**
+ * Draw a string on the framebuffer
+ */
+void lcd_fb_write(char *str) {
+    unsigned char i = 0;
+
+    while (str[i] != '\0')
+        lcd_fb_putc(str[i++]);
+}
+
+#if LCD_BIG_DIGITS
+/**
+ * Upload the 8 segments now (Waits for the queue), so the first big digit
+ * frame doesn't need 72 queue entries of glyphs. Call after lcd_initialize().
+ */
+void lcd_fb_big_digit_load(void) {
+    unsigned char i;
+
+    for (i = 0; i < 8; i++) {
+        lcd_add_character(i, g_big_glyphs[i]);
+        g_glyph_slot[i] = g_big_glyphs[i]; // lcd_glyph() finds them loaded
+    }
+}
+
+/**
+ * Draw a 3 columns x 2 rows digit on the framebuffer, only the cells
+ * that differ from the previous digit are sent by lcd_fb_flush()
+ * @param row Top row (1 to LCD_LINES - 1)
+ * @param col Left column
+ * @param digit 0-9
+ */
+void lcd_fb_big_digit(unsigned char row, unsigned char col, unsigned char digit) {
+    unsigned char i, cell;
+
+    if (digit > 9)
+        return;
+    for (i = 0; i < 6; i++) {
+        if (i == 0)
+            lcd_fb_goto(row, col);
+        else if (i == 3)
+            lcd_fb_goto(row + 1, col);
+        cell = g_big_digits[digit][i];
+        if (cell < 8)
+            cell = lcd_glyph(g_big_glyphs[cell]);
+        lcd_fb_putc(cell);
+    }
+}
+#endif
+
+/**
+ * Send the dirty cells to the LCD in one I2C transaction, the cursor is
+ * only moved when the next dirty cell isn't at the LCD address counter.
+ * @return true = all sent, false = queue full, call it again after lcd_task()
+ */
+bool lcd_fb_flush(void) {
+    unsigned char r, c, addr;
+    unsigned char cursor = 0xFF; // LCD address counter, unknown at start
+    uint8_t mask;
+
+    for (r = 0; r < LCD_LINES; r++) {
+        for (c = 0; c < LCD_CHARACTERS; c++) {
+            mask = (uint8_t) (1 << (c & 0x07));
+            if (g_fb_dirty[r][c >> 3] & mask) {
+                addr = _line_addr(r + 1) + c;
+                if (!_room(3)) {
+                    // Queue full, the rest stays dirty for the next flush
+                    return false;
+                }
+                if ((c > 0) && (cursor == (unsigned char) (addr - 1))) {
+                    // One clean cell between runs, rewriting it is
+                    // cheaper than a cursor move
+                    _put(1, g_fb[r][c - 1]);
+                    cursor++;
+                }
+                if (cursor != addr) {
+                    _put(0, SET_DDRAM_ADDR | addr);
+                    cursor = addr;
+                }
+                _put(1, g_fb[r][c]);
+                g_fb_dirty[r][c >> 3] &= ~mask;
+                cursor++;
+            }
+        }
+    }
+    _burst_end();
+    return true;
+}
+#endif
\ No newline at end of file
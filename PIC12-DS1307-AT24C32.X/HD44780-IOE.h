@@ -26,6 +26,14 @@
         08/04/2014
         - Updated to XC8
         - Changed to be use with MCP23017 I/O Expander on IOA instead of STP
+        10/19/2026
+        - Nibbles are streamed to IOA in one I2C burst per command/string
+        - Added shadow framebuffer (lcd_fb_*) with dirty cell flush
+        - Added LCD_RW_MODE busy flag polling for clear/home
+        - Added LCD_INTERFACE_8BIT, data on IOA and control pins on IOB
+        - Added command queue drained by lcd_task() (LCD_QUEUE_SIZE)
+        - Added CGRAM glyph manager lcd_glyph() with LRU slots
+        - Added 3x2 big digits lcd_fb_big_digit(), lcd_fb_big_digit_load()
  **/
 
 /******************************* CONFIG ***************************************/
@@ -39,6 +47,39 @@
 #define LCD_LINES           2
 #define LCD_CHARACTERS      16
 
+// shadow framebuffer: 1 = lcd_fb_* functions enabled (LCD_LINES*LCD_CHARACTERS bytes of RAM)
+#define LCD_FRAMEBUFFER     1
+
+// glyph manager: 1 = lcd_glyph() maps any number of const (flash) patterns
+// on the 8 CGRAM slots, least recently used slot is replaced on a miss
+#define LCD_GLYPHS          1
+#define LCD_GLYPH_NONE      ' ' // lcd_glyph() can't load the pattern now, draw it again later
+
+// big digits: 1 = lcd_fb_big_digit() draws 3x2 cell digits on the framebuffer
+// using 8 custom glyphs (needs LCD_FRAMEBUFFER and LCD_GLYPHS)
+#define LCD_BIG_DIGITS      1
+
+// command queue: entries (power of 2) for commands/data, the LCD is written
+// by lcd_task() from the main loop so lcd_*() calls don't block. When it is
+// full they send the oldest entries themselves, so nothing is lost
+// (lcd_fb_flush() leaves the cells dirty instead). Main loop only.
+// 0 = no queue, lcd_*() write directly.
+#define LCD_QUEUE_SIZE      32
+#define LCD_QUEUE_DRAIN_MAX 8 // Max entries sent by each lcd_task() call
+
+// interface: 1 = 8-bit, data (D0-D7) on IOA and control pins on IOB,
+//                one enable strobe per byte but IOB can't be used by the keypad
+//            0 = 4-bit, data (D4-D7) and control pins on IOA
+#define LCD_INTERFACE_8BIT  0
+
+#if LCD_INTERFACE_8BIT
+// LCD control pins on IOB (IOB0-IOB7)
+#define LCD_RS		P0
+#define LCD_EN		P1
+#define LCD_BL		P2
+#define LCD_RW		P3
+#define LCD_BUSY_FLAG       0x80 // DB7
+#else
 // data mask
 // this must match the data pins on the port
 // this program uses 4 lower bits of PORT
@@ -50,15 +91,35 @@
 #define DATA_SHIFT 0
 
 // LCD pins on IOA (IOA0-IOA7)
-#define LCD_RS		A4
-#define LCD_EN		A5
-#define LCD_BL		A6
+#define LCD_RS		P4
+#define LCD_EN		P5
+#define LCD_BL		P6
+#define LCD_RW		P7
+#define LCD_BUSY_FLAG       (0b1000 << DATA_SHIFT) // DB7 on the data nibble
+
+// Padding byte written to IOB on every burst write, the MCP23017 runs in
+// byte mode so the address pointer toggles between GPIOA and GPIOB.
+// IOB must be used as input (only OLATB is changed).
+#define LCD_BURST_PAD       0x00
+#endif
+
+// R/W mode: 1 = LCD R/W pin wired to LCD_RW, the busy flag is polled
+//           0 = LCD R/W pin connected to GND, fixed delays are used
+#define LCD_RW_MODE         0
+#define LCD_BUSY_TIMEOUT    200 // Max busy flag reads
 
 // timings: depend on the instruction clock speed
-#define LCD_ADDRESS_SETUP_DELAY()   NOP()           	// > 40 ns
+// In a burst every port write is two I2C bytes (18 SCL clocks) apart:
+// 180 us at the 100 KHz of main.c, 45 us at 400 KHz. That covers the
+// enable pulse, setup/hold and execution (37 us) times, so no
+// LCD_EXECUTION_DELAY is needed inside a burst with a bus up to 480 KHz
+// (18 / 37 us). Slower is always safe, the 1 MHz mode is not.
 #define LCD_EXECUTION_DELAY()       __delay_us(50)      // > 50 us
-#define LCD_ENABLE_PULSE_DELAY()    __delay_us(250)	// > 250 ns
+#if LCD_RW_MODE
+#define LCD_HOME_CLEAR_DELAY()      lcd_wait_busy()     // until BF = 0
+#else
 #define LCD_HOME_CLEAR_DELAY()      __delay_ms(2)	// > 1.6 ms
+#endif
 #define LCD_START_DELAY()           __delay_ms(10)      // ~ 10 ms
 
 // Lines directions for gotoxy function
@@ -104,12 +165,36 @@ void lcd_command(unsigned char);
 void lcd_data(unsigned char);
 void lcd_write(char *);
 void lcd_goto(unsigned char, unsigned char);
-void lcd_add_character(unsigned char, unsigned char *);
+void lcd_add_character(unsigned char, const unsigned char *);
 void lcd_backlight(bool);
+#if LCD_GLYPHS
+unsigned char lcd_glyph(const unsigned char *);
+#endif
+#if LCD_QUEUE_SIZE > 0
+unsigned char lcd_queue_free(void);
+void lcd_task(void);
+#else
+#define lcd_task()          // Nothing queued
+#endif
+#if LCD_RW_MODE
+void lcd_wait_busy(void);
+#endif
+#if LCD_FRAMEBUFFER
+void lcd_fb_clear(void);
+void lcd_fb_invalidate(void);
+void lcd_fb_goto(unsigned char, unsigned char);
+void lcd_fb_putc(char);
+void lcd_fb_write(char *);
+bool lcd_fb_flush(void);
+#if LCD_BIG_DIGITS
+void lcd_fb_big_digit_load(void);
+void lcd_fb_big_digit(unsigned char, unsigned char, unsigned char);
+#endif
+#endif
 
 // inline functions
-#define lcd_clear()         lcd_command(CLEAR_DISPLAY); LCD_HOME_CLEAR_DELAY()
-#define lcd_return_home()   lcd_command(RETURN_HOME); LCD_HOME_CLEAR_DELAY()
+#define lcd_clear()         lcd_command(CLEAR_DISPLAY)
+#define lcd_return_home()   lcd_command(RETURN_HOME)
 
 #define lcd_display_on()    lcd_flags_set(DISPLAY_CONTROL, DISPLAY_ON, 1)
 #define lcd_display_off()   lcd_flags_set(DISPLAY_CONTROL, DISPLAY_ON, 0)
@@ -0,0 +1,193 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       alarm.c
+ * Created On:      October 19, 2026, 2:15 PM
+ * Description:     Entry transfers to the DS1307 RAM and the due alarm search
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    One RAM block per entry
+ * 1.2      10/19/26    Missed repetitions skipped by division
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "alarm.h"
+#include "main.h"
+#include "ds1307.h"
+
+/** PRIVATE DEFINES ************************************************/
+#define ALARM_MAGIC         0xA5 // First byte, entries are valid
+#define ALARM_ENTRIES_ADDR  (ALARM_RAM_ADDR + 1)
+
+#define ALARM_OFS_FLAGS     0
+#define ALARM_OFS_EPOCH     1
+#define ALARM_OFS_PERIOD    5
+
+/** PRIVATE VARIABLES **********************************************/
+typedef struct {
+    uint8_t flags;
+    uint32_t epoch;
+    uint16_t period; // Minutes
+} alarm_entry_t;
+
+static alarm_callback_t g_callback;
+static uint32_t g_next_due; // Epoch of the next alarm
+static uint8_t g_next_id; // ALARM_NONE = nothing scheduled
+static volatile uint32_t g_now; // Last epoch from alarm_tick()
+static volatile bool g_pending; // g_next_id is due
+
+/** PRIVATE FUNCTION PROTOTYPES ************************************/
+static void _read_entry(uint8_t, alarm_entry_t*);
+static void _write_entry(uint8_t, const alarm_entry_t*);
+static void _schedule(void);
+
+/** PRIVATE FUNCTION DEFINITIONS ***********************************/
+static void _read_entry(uint8_t id, alarm_entry_t* p_entry) {
+    uint8_t raw[ALARM_ENTRY_SIZE];
+
+    ds1307_read_ram_block(ALARM_ENTRIES_ADDR + id * ALARM_ENTRY_SIZE, raw, ALARM_ENTRY_SIZE);
+    p_entry->flags = raw[ALARM_OFS_FLAGS];
+    p_entry->epoch = raw[ALARM_OFS_EPOCH + 3]; // Little endian, MSB first
+    for (uint8_t b = 3; b > 0; b--) {
+        p_entry->epoch = (p_entry->epoch << 8) | raw[ALARM_OFS_EPOCH + b - 1];
+    }
+    p_entry->period = raw[ALARM_OFS_PERIOD] | ((uint16_t) raw[ALARM_OFS_PERIOD + 1] << 8);
+    if (p_entry->period == 0) {
+        p_entry->flags &= ~ALARM_FLAG_REPEAT; // Corrupt entry, one-shot
+    }
+}
+
+static void _write_entry(uint8_t id, const alarm_entry_t* p_entry) {
+    uint8_t raw[ALARM_ENTRY_SIZE];
+    uint32_t epoch = p_entry->epoch;
+
+    raw[ALARM_OFS_FLAGS] = p_entry->flags;
+    for (uint8_t b = 0; b < 4; b++) {
+        raw[ALARM_OFS_EPOCH + b] = (uint8_t) epoch;
+        epoch >>= 8;
+    }
+    raw[ALARM_OFS_PERIOD] = (uint8_t) p_entry->period;
+    raw[ALARM_OFS_PERIOD + 1] = (uint8_t) (p_entry->period >> 8);
+    ds1307_write_ram_block(ALARM_ENTRIES_ADDR + id * ALARM_ENTRY_SIZE, raw, ALARM_ENTRY_SIZE);
+}
+
+static void _schedule(void) {
+    // Scan once here, so alarm_tick() only compares with the earliest one
+    alarm_entry_t entry;
+    uint8_t next_id = ALARM_NONE;
+    uint32_t next_due = 0xFFFFFFFF;
+
+    for (uint8_t id = 0; id < ALARM_COUNT; id++) {
+        _read_entry(id, &entry);
+        if ((entry.flags & ALARM_FLAG_ENABLED) && (entry.epoch < next_due)) {
+            next_due = entry.epoch;
+            next_id = id;
+        }
+    }
+    g_next_due = next_due;
+    g_next_id = next_id;
+    g_pending = false;
+}
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+void alarm_init(uint32_t now, alarm_callback_t callback) {
+    g_callback = callback;
+    g_now = now;
+    if (ds1307_read_ram(ALARM_RAM_ADDR) != ALARM_MAGIC) {
+        // New battery, the RAM is random
+        for (uint8_t id = 0; id < ALARM_COUNT; id++) {
+            ds1307_write_ram(ALARM_ENTRIES_ADDR + id * ALARM_ENTRY_SIZE + ALARM_OFS_FLAGS, 0x00);
+        }
+        ds1307_write_ram(ALARM_RAM_ADDR, ALARM_MAGIC);
+    }
+    _schedule();
+}
+
+void alarm_set(uint8_t id, uint32_t epoch, uint16_t period_min) {
+    alarm_entry_t entry;
+
+    entry.flags = ALARM_FLAG_ENABLED;
+    if (period_min != 0) {
+        entry.flags |= ALARM_FLAG_REPEAT;
+    }
+    entry.epoch = epoch;
+    entry.period = period_min;
+    _write_entry(id, &entry);
+    _schedule();
+}
+
+void alarm_clear(uint8_t id) {
+    ds1307_write_ram(ALARM_ENTRIES_ADDR + id * ALARM_ENTRY_SIZE + ALARM_OFS_FLAGS, 0x00);
+    _schedule();
+}
+
+void alarm_tick(uint32_t now) {
+    g_now = now;
+    if ((g_next_id != ALARM_NONE) && (now >= g_next_due)) {
+        g_pending = true;
+    }
+}
+
+void alarm_task(void) {
+    alarm_entry_t entry;
+    uint8_t id;
+    uint32_t now;
+    uint32_t period;
+
+    if (!g_pending) {
+        return;
+    }
+    id = g_next_id;
+    now = g_now;
+    _read_entry(id, &entry);
+    if (entry.flags & ALARM_FLAG_REPEAT) {
+        // Skip the missed repetitions too (Clock changed or powered off),
+        // one division instead of a loop per missed period
+        period = (uint32_t) entry.period * 60;
+        if (entry.epoch <= now) {
+            entry.epoch += ((now - entry.epoch) / period + 1) * period;
+        } else {
+            entry.epoch += period;
+        }
+    } else {
+        entry.flags = 0x00; // One-shot, done
+    }
+    _write_entry(id, &entry);
+    _schedule();
+
+    if (g_callback != NULL) {
+        g_callback(id);
+    }
+}
+
+uint8_t alarm_next(void) {
+    return g_next_id;
+}
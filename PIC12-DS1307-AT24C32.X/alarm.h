@@ -0,0 +1,96 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       alarm.h
+ * Created On:      October 19, 2026, 2:15 PM
+ * Description:     One-shot and recurring alarms kept in the DS1307
+ *                  battery-backed RAM. Only the next due alarm is kept
+ *                  in PIC RAM, so alarm_tick() is a single compare.
+ *                  RAM = |MAGIC|Entry 0|...|Entry ALARM_COUNT-1|
+ *                  Entry[7] = |FLAGS|EPOCH<7:0>...EPOCH<31:24>|PERIOD<7:0>|PERIOD<15:8>|
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ *********************************************************************/
+
+#ifndef __ALARM_H
+#define __ALARM_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define ALARM_COUNT         4    // Entries, 1 + ALARM_COUNT * 7 <= DS1307_RAM_SIZE
+#define ALARM_RAM_ADDR      0x00 // First DS1307 RAM byte used
+
+#define ALARM_ENTRY_SIZE    7
+#define ALARM_FLAG_ENABLED  0x01
+#define ALARM_FLAG_REPEAT   0x02 // Add the period after firing, else disable
+
+#define ALARM_NONE          0xFF // No alarm is due
+
+typedef void (*alarm_callback_t)(uint8_t id);
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Load the entries from the DS1307 RAM and schedule the next one (Before GIE is set)
+ * @param now Current epoch (calendar.h)
+ * @param callback Function called by alarm_task() with the alarm id
+ */
+void alarm_init(uint32_t now, alarm_callback_t callback);
+/**
+ * Store an alarm
+ * @param id Alarm (0 -> ALARM_COUNT-1)
+ * @param epoch First due time (calendar.h)
+ * @param period_min Minutes between repetitions, 0 = one-shot (1440 = daily)
+ */
+void alarm_set(uint8_t id, uint32_t epoch, uint16_t period_min);
+/**
+ * Disable an alarm
+ * @param id Alarm (0 -> ALARM_COUNT-1)
+ */
+void alarm_clear(uint8_t id);
+/**
+ * Call this function every second (ISR safe, no bus access)
+ * @param now Current epoch
+ */
+void alarm_tick(uint32_t now);
+/**
+ * Call this function from the main loop, fires the due alarm
+ */
+void alarm_task(void);
+/**
+ * Get the next alarm to fire
+ * @return Alarm id or ALARM_NONE
+ */
+uint8_t alarm_next(void);
+
+#endif // __ALARM_H
@@ -0,0 +1,218 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       calendar.c
+ * Created On:      October 19, 2026, 12:30 PM
+ * Description:     Leap years, month lengths and epoch conversions by loops
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Month range check
+ *                      Also in cal_days()
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "calendar.h"
+#include "ds1307.h"
+
+/** PRIVATE DEFINES ************************************************/
+#define CAL_SECONDS_PER_YEAR    (365UL * CAL_SECONDS_PER_DAY)
+
+/** PRIVATE VARIABLES **********************************************/
+static const uint8_t g_month_days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+// Days before the first of each month (Non leap year)
+static const uint16_t g_month_start[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+/** PRIVATE FUNCTION PROTOTYPES ************************************/
+static uint8_t _mod7(uint16_t);
+
+/** PRIVATE FUNCTION DEFINITIONS ***********************************/
+static uint8_t _mod7(uint16_t value) {
+    // 8 = 1 (mod 7), so adding the octal digits keeps the rest
+    while (value > 7) {
+        value = (value >> 3) + (value & 0x07);
+    }
+    if (value == 7) {
+        value = 0;
+    }
+    return (uint8_t) value;
+}
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+bool cal_is_leap(uint8_t year) {
+    // 2000 is leap and 2100 is out of range, so every 4 years
+    return ((year & 0x03) == 0);
+}
+
+uint8_t cal_days_in_month(uint8_t year, uint8_t month) {
+    if ((month < 1) || (month > 12)) {
+        return 31; // Corrupt month (e.g. DS1307 lost power), no table overrun
+    }
+    if ((month == 2) && cal_is_leap(year)) {
+        return 29;
+    }
+    return g_month_days[month - 1];
+}
+
+uint16_t cal_days(uint8_t year, uint8_t month, uint8_t day) {
+    uint16_t days;
+
+    if ((month < 1) || (month > 12)) {
+        month = 1; // Corrupt month (e.g. DS1307 lost power), no table overrun
+    }
+    // 365 days per year plus one per leap year before it (2000 included)
+    days = (uint16_t) year * 365 + ((uint8_t) (year + 3) >> 2);
+    days += g_month_start[month - 1];
+    if ((month > 2) && cal_is_leap(year)) {
+        days++; // Past February 29
+    }
+    return days + day - 1;
+}
+
+uint8_t cal_day_of_week(uint8_t year, uint8_t month, uint8_t day) {
+    // 01/01/2000 was saturday, +6 moves it to the 7th day from sunday
+    return _mod7(cal_days(year, month, day) + 6) + CAL_SUNDAY;
+}
+
+uint32_t cal_to_epoch(const cal_time_t* p_time) {
+    uint32_t epoch;
+
+    epoch = (uint32_t) cal_days(p_time->year, p_time->month, p_time->day) * CAL_SECONDS_PER_DAY;
+    epoch += (uint32_t) p_time->hours * CAL_SECONDS_PER_HOUR;
+    epoch += (uint16_t) p_time->minutes * (uint16_t) CAL_SECONDS_PER_MINUTE;
+    return epoch + p_time->seconds;
+}
+
+void cal_from_epoch(uint32_t epoch, cal_time_t* p_time) {
+    uint32_t length;
+    uint16_t rest;
+
+    // Take whole years, months and days out, up to ~220 subtractions
+    p_time->year = 0;
+    for (;;) {
+        length = cal_is_leap(p_time->year) ? CAL_SECONDS_PER_YEAR + CAL_SECONDS_PER_DAY : CAL_SECONDS_PER_YEAR;
+        if (epoch < length) {
+            break;
+        }
+        epoch -= length;
+        p_time->year++;
+    }
+    p_time->month = 1;
+    for (;;) {
+        length = cal_days_in_month(p_time->year, p_time->month) * CAL_SECONDS_PER_DAY;
+        if (epoch < length) {
+            break;
+        }
+        epoch -= length;
+        p_time->month++;
+    }
+    p_time->day = 1;
+    while (epoch >= CAL_SECONDS_PER_DAY) {
+        epoch -= CAL_SECONDS_PER_DAY;
+        p_time->day++;
+    }
+    p_time->hours = 0;
+    while (epoch >= CAL_SECONDS_PER_HOUR) {
+        epoch -= CAL_SECONDS_PER_HOUR;
+        p_time->hours++;
+    }
+    rest = (uint16_t) epoch; // < 3600
+    p_time->minutes = 0;
+    while (rest >= CAL_SECONDS_PER_MINUTE) {
+        rest -= CAL_SECONDS_PER_MINUTE;
+        p_time->minutes++;
+    }
+    p_time->seconds = (uint8_t) rest;
+    p_time->dow = cal_day_of_week(p_time->year, p_time->month, p_time->day);
+}
+
+int32_t cal_diff(uint32_t to, uint32_t from) {
+    return (int32_t) (to - from);
+}
+
+void cal_get_ds1307(cal_time_t* p_time) {
+    p_time->year = ds1307_get_year();
+    p_time->month = ds1307_get_month();
+    p_time->day = ds1307_get_day_of_month();
+    p_time->hours = ds1307_get_hours();
+    if (ds1307_is_12hr_mode()) {
+        // 12am = 0, 1pm -> 11pm = hr + 12
+        if (p_time->hours == 12) {
+            p_time->hours = 0;
+        }
+        if (ds1307_is_pm()) {
+            p_time->hours += 12;
+        }
+    }
+    p_time->minutes = ds1307_get_minutes();
+    p_time->seconds = ds1307_get_seconds();
+    p_time->dow = ds1307_get_day_of_week();
+}
+
+void cal_set_ds1307(const cal_time_t* p_time) {
+    uint8_t hours = p_time->hours;
+
+    ds1307_set_year(p_time->year);
+    ds1307_set_month(p_time->month);
+    ds1307_set_day_of_month(p_time->day);
+    ds1307_set_day_of_week(cal_day_of_week(p_time->year, p_time->month, p_time->day));
+    if (ds1307_is_12hr_mode()) {
+        // 0 = 12am, 13 -> 23 = hr - 12 pm
+        ds1307_set_pm_am(hours > 11 ? DS1307_SET_PM : DS1307_SET_AM);
+        if (hours == 0) {
+            hours = 12;
+        } else if (hours > 12) {
+            hours -= 12;
+        }
+    }
+    ds1307_set_hours(hours);
+    ds1307_set_minutes(p_time->minutes);
+    ds1307_set_seconds(p_time->seconds);
+}
+
+uint32_t cal_ds1307_epoch(void) {
+    cal_time_t now;
+
+    cal_get_ds1307(&now);
+    return cal_to_epoch(&now);
+}
+
+void cal_fix_ds1307_date(void) {
+    uint8_t year = ds1307_get_year();
+    uint8_t month = ds1307_get_month();
+    uint8_t day = ds1307_get_day_of_month();
+    uint8_t last = cal_days_in_month(year, month);
+
+    if (day > last) {
+        day = last; // 31 -> 30, 31 -> 28/29 for February
+        ds1307_set_day_of_month(day);
+    }
+    ds1307_set_day_of_week(cal_day_of_week(year, month, day));
+}
@@ -0,0 +1,140 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       calendar.h
+ * Created On:      October 19, 2026, 12:30 PM
+ * Description:     Calendar math for the DS1307 range (2000-2099).
+ *                  Epoch is seconds since 01/01/2000 00:00:00, so any
+ *                  date fits in 32 bits and differences are subtractions.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ *********************************************************************/
+
+#ifndef __CALENDAR_H
+#define __CALENDAR_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define CAL_SUNDAY      1 // Day of the week numbers written to the DS1307
+#define CAL_MONDAY      2
+#define CAL_TUESDAY     3
+#define CAL_WEDNESDAY   4
+#define CAL_THURSDAY    5
+#define CAL_FRIDAY      6
+#define CAL_SATURDAY    7
+
+#define CAL_SECONDS_PER_MINUTE  60UL
+#define CAL_SECONDS_PER_HOUR    3600UL
+#define CAL_SECONDS_PER_DAY     86400UL
+
+typedef struct {
+    uint8_t year; // 0-99 = 2000-2099
+    uint8_t month; // 1-12
+    uint8_t day; // 1-31
+    uint8_t hours; // 0-23
+    uint8_t minutes; // 0-59
+    uint8_t seconds; // 0-59
+    uint8_t dow; // CAL_SUNDAY -> CAL_SATURDAY (Output only)
+} cal_time_t;
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Check for a leap year
+ * @param year Year (0-99)
+ * @return true = leap year
+ */
+bool cal_is_leap(uint8_t year);
+/**
+ * Get the number of days of a month
+ * @param year Year (0-99)
+ * @param month Month (1-12)
+ * @return Days (28-31), 31 for a month out of range
+ */
+uint8_t cal_days_in_month(uint8_t year, uint8_t month);
+/**
+ * Get the days since 01/01/2000
+ * @param year Year (0-99)
+ * @param month Month (1-12), January if out of range
+ * @param day Day of the month (1-31)
+ * @return Days (0-36524)
+ */
+uint16_t cal_days(uint8_t year, uint8_t month, uint8_t day);
+/**
+ * Get the day of the week
+ * @param year Year (0-99)
+ * @param month Month (1-12)
+ * @param day Day of the month (1-31)
+ * @return CAL_SUNDAY -> CAL_SATURDAY
+ */
+uint8_t cal_day_of_week(uint8_t year, uint8_t month, uint8_t day);
+/**
+ * Convert to seconds since 01/01/2000 00:00:00
+ * @param p_time Pointer to time (dow is not used)
+ * @return Epoch seconds
+ */
+uint32_t cal_to_epoch(const cal_time_t* p_time);
+/**
+ * Convert from seconds since 01/01/2000 00:00:00 (No divisions)
+ * @param epoch Epoch seconds
+ * @param p_time Pointer to time, dow is assigned too
+ */
+void cal_from_epoch(uint32_t epoch, cal_time_t* p_time);
+/**
+ * Difference between two epochs
+ * @param to Later epoch
+ * @param from Earlier epoch
+ * @return Seconds from "from" to "to" (Negative if "to" is earlier)
+ */
+int32_t cal_diff(uint32_t to, uint32_t from);
+/**
+ * Get the ds1307 shadow time (12hr mode is converted to 24hr)
+ * @param p_time Pointer to time
+ */
+void cal_get_ds1307(cal_time_t* p_time);
+/**
+ * Set the ds1307 shadow time and day of the week (Keeps the hr mode, no bus access)
+ * @param p_time Pointer to time
+ */
+void cal_set_ds1307(const cal_time_t* p_time);
+/**
+ * Get the ds1307 shadow time as epoch
+ * @return Epoch seconds
+ */
+uint32_t cal_ds1307_epoch(void);
+/**
+ * Clamp the ds1307 shadow day to the month length and compute its day of the week
+ */
+void cal_fix_ds1307_date(void);
+
+#endif // __CALENDAR_H
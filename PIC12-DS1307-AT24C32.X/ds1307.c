@@ -33,13 +33,22 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      08/01/14    Initial version
+ * 1.1      10/19/26    Formatting without sprintf (format.c)
+ *                      BCD field API, table based dec_to_bcd
+ *                      Single transaction set_clock, set_field
+ *                      advance_second for softrtc.c
+ *                      Month length limits (calendar.c), set_date
+ *                      RAM block read/write, RAM shadow
+ *                      Partial reads with valid mask
+ * 1.2      10/19/26    Range checks on the RAM and register blocks
  *********************************************************************/
 
 /** INCLUDES *******************************************************/
 #include "ds1307.h"
 #include "main.h"
 #include "pic12f1840_i2c.h"
-#include <stdio.h>
+#include "format.h"
+#include "calendar.h"
 
 /** PRIVATE DEFINES ************************************************/
 
@@ -58,23 +67,76 @@ typedef union {
 
 static uint8_t g_reg_data[7];
 static reg_ctrl_t g_reg_ctrl;
+static uint8_t g_reg_valid; // Bit n = register n was read from the device
+#if DS1307_RAM_SHADOW > 0
+static uint8_t g_ram[DS1307_RAM_SHADOW];
+static uint8_t g_ram_dirty_lo = 0xFF; // First dirty byte, 0xFF = clean
+static uint8_t g_ram_dirty_hi; // Last dirty byte
+#endif
+
+// Valid bits of each field, hours is 0x1F in 12hr mode
+static const uint8_t g_reg_mask[7] = {0x7F, 0x7F, 0x3F, 0x07, 0x3F, 0x1F, 0xFF};
+// Limits of each field in BCD, hours are 0x01 -> 0x12 in 12hr mode
+static const uint8_t g_reg_min[7] = {0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00};
+static const uint8_t g_reg_max[7] = {0x59, 0x59, 0x23, 0x07, 0x31, 0x12, 0x99};
+// Decimal (0-99) to BCD without divisions
+static const uint8_t g_dec_to_bcd[100] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99
+};
 
 /** PRIVATE FUNCTION PROTOTYPES ************************************/
 uint8_t dec_to_bcd(uint8_t);
 uint8_t bcd_to_dec(uint8_t);
+static uint8_t _reg_mask(uint8_t);
+static uint8_t _reg_min(uint8_t);
+static uint8_t _reg_max(uint8_t);
 
 /** PRIVATE FUNCTION DEFINITIONS ***********************************/
 uint8_t dec_to_bcd(uint8_t dec) {
-    // dec / 10 = high value, just move it to <7:4>
-    // dec % 10 = rest, just insert it to <3:0>
-    return (((uint8_t) (dec / 10) << 4) | (dec % 10));
+    // Out of range values are not valid BCD, callers check the limits first
+    return g_dec_to_bcd[dec];
 }
 
 uint8_t bcd_to_dec(uint8_t bcd) {
-    // 10 value = (bcd >> 4) * 10
+    // 10 value = (bcd >> 4) * 10 = (bcd >> 4) * 8 + (bcd >> 4) * 2
     // 1 value = clear high nibble
     // add both
-    return (((bcd >> 4)*10) + (bcd & 0x0F));
+    uint8_t tens = bcd >> 4;
+    return ((uint8_t) (tens << 3) + (uint8_t) (tens << 1) + (bcd & 0x0F));
+}
+
+static uint8_t _reg_mask(uint8_t reg) {
+    if ((reg == DS1307_REG_HOURS) && ds1307_is_12hr_mode()) {
+        return 0x1F;
+    }
+    return g_reg_mask[reg];
+}
+
+static uint8_t _reg_min(uint8_t reg) {
+    if ((reg == DS1307_REG_HOURS) && ds1307_is_12hr_mode()) {
+        return 0x01;
+    }
+    return g_reg_min[reg];
+}
+
+static uint8_t _reg_max(uint8_t reg) {
+    if ((reg == DS1307_REG_HOURS) && ds1307_is_12hr_mode()) {
+        return 0x12;
+    }
+    if (reg == DS1307_REG_DAY_OM) {
+        // 28 -> 31 depending on month and year
+        return dec_to_bcd(cal_days_in_month(ds1307_get_year(), ds1307_get_month()));
+    }
+    return g_reg_max[reg];
 }
 
 /** PUBLIC FUNCTION DEFINITIONS ************************************/
@@ -138,29 +200,71 @@ bool ds1307_is_stopped(void) {
 }
 
 void ds1307_get_clock(void) {
+    // Seconds -> Control
+    ds1307_get_regs(DS1307_REG_SECONDS, 8);
+}
+
+void ds1307_get_regs(uint8_t first, uint8_t count) {
+    uint8_t value;
+
+    if (first > DS1307_REG_CONTROL) {
+        return; // RAM, not a register
+    }
+    if (count > DS1307_REG_CONTROL + 1 - first) {
+        count = DS1307_REG_CONTROL + 1 - first; // Up to Control
+    }
+
     // Read Continuos =
     // |S|1101000W|A|ADDR|A|SR|1101000R|A|DATA0|A|DATA1|A|....|DATA_N|NA|P|
     i2c_start();
     i2c_send_address(DS1307_SLAVE_ADDR, I2C_ADDRESS_MODE_WRITE);
-    i2c_send_data(0x00); // First address location
+    i2c_send_data(first); // First address location
     i2c_restart();
     i2c_send_address(DS1307_SLAVE_ADDR, I2C_ADDRESS_MODE_READ);
-    for (uint8_t r = 0x00; r < 0x07; r++) { // 0x00 -> 0x06
-
-        g_reg_data[r] = i2c_read_data();
-        i2c_send_ack(I2C_ACK);
+    while (count != 0) {
+        value = i2c_read_data();
+        count--;
+        i2c_send_ack((count != 0) ? I2C_ACK : I2C_NACK); // NACK the last one
+        if (first == DS1307_REG_CONTROL) {
+            g_reg_ctrl.byte = value; // 0x07 = Control register
+        } else {
+            g_reg_data[first] = value;
+        }
+        g_reg_valid |= (uint8_t) (1 << first);
+        first++;
     }
-    g_reg_ctrl.byte = i2c_read_data(); // 0x07 = Control register
-    i2c_send_ack(I2C_NACK);
     i2c_stop();
 }
 
+void ds1307_read_time(void) {
+    // Seconds, minutes, hours = 3 bytes
+    ds1307_get_regs(DS1307_REG_SECONDS, 3);
+}
+
+void ds1307_read_date(void) {
+    // Day of the week, day, month, year = 4 bytes
+    ds1307_get_regs(DS1307_REG_DAY_OW, 4);
+}
+
+void ds1307_read_seconds(void) {
+    ds1307_get_regs(DS1307_REG_SECONDS, 1);
+}
+
+uint8_t ds1307_valid_mask(void) {
+    return g_reg_valid;
+}
+
+void ds1307_invalidate(uint8_t mask) {
+    g_reg_valid &= (uint8_t) ~mask;
+}
+
 void ds1307_set_clock(void) {
-    // Stop clock, then write all registers but with Seconds<7> CH = 1 (Clk off)
-    // then start the clock again
+    // Writing the seconds resets the countdown chain and the other registers
+    // follow in the same burst (< 1s), so no stop/start is needed.
+    // Write Continuos =
+    // |S|1101000W|A|0x00|A|SEC CH=0|A|MIN|A|....|YEAR|A|P|
 
-    ds1307_stop_clock();
-    g_reg_data[DS1307_REG_SECONDS] = g_reg_data[DS1307_REG_SECONDS] | 0x80;
+    g_reg_data[DS1307_REG_SECONDS] = g_reg_data[DS1307_REG_SECONDS] & 0x7F; // CH = 0
     i2c_start();
     i2c_send_address(DS1307_SLAVE_ADDR, I2C_ADDRESS_MODE_WRITE);
     i2c_send_data(0x00); // Initial address location
@@ -168,7 +272,23 @@ void ds1307_set_clock(void) {
         i2c_send_data(g_reg_data[r]);
     }
     i2c_stop();
-    ds1307_start_clock();
+}
+
+void ds1307_set_date(void) {
+    // Seconds are not written, the countdown chain keeps running
+    // |S|1101000W|A|0x03|A|DOW|A|DOM|A|MONTH|A|YEAR|A|P|
+    i2c_start();
+    i2c_send_address(DS1307_SLAVE_ADDR, I2C_ADDRESS_MODE_WRITE);
+    i2c_send_data(DS1307_REG_DAY_OW); // Initial address location
+    for (uint8_t r = DS1307_REG_DAY_OW; r <= DS1307_REG_YEAR; r++) {
+        i2c_send_data(g_reg_data[r]);
+    }
+    i2c_stop();
+}
+
+void ds1307_set_field(uint8_t reg) {
+    // Only one register, the rest of the clock keeps running
+    ds1307_write_addr(reg, g_reg_data[reg]);
 }
 
 void ds1307_set_control(uint8_t out, uint8_t sqwe, uint8_t rs) {
@@ -185,6 +305,75 @@ bool ds1307_is_12hr_mode(void) {
     return ((g_reg_data[DS1307_REG_HOURS] & 0x40) == 0x40);
 }
 
+uint8_t ds1307_get_bcd(uint8_t reg) {
+    return (g_reg_data[reg] & _reg_mask(reg));
+}
+
+void ds1307_set_bcd(uint8_t reg, uint8_t bcd) {
+    uint8_t mask = _reg_mask(reg);
+
+    // Update only if it's a valid BCD inside the field limits
+    if (((bcd & 0x0F) < 0x0A) && (bcd >= _reg_min(reg)) && (bcd <= _reg_max(reg))) {
+        // Keep CH, 12hr mode and pm bits
+        g_reg_data[reg] = bcd | (g_reg_data[reg] & (uint8_t) ~mask);
+    }
+}
+
+uint8_t ds1307_bcd_step(uint8_t bcd, uint8_t lim_dwn, uint8_t lim_up, bool up_down) {
+    if ((bcd == lim_up) && (up_down)) {
+        bcd = lim_dwn;
+    } else if ((bcd == lim_dwn) && (!up_down)) {
+        bcd = lim_up;
+    } else if (up_down) {
+        bcd++;
+        if ((bcd & 0x0F) == 0x0A) { // x9 + 1 = (x+1)0
+            bcd += 0x06;
+        }
+    } else {
+        if ((bcd & 0x0F) == 0x00) { // x0 - 1 = (x-1)9
+            bcd -= 0x06;
+        }
+        bcd--;
+    }
+    return bcd;
+}
+
+void ds1307_step_field(uint8_t reg, bool up_down) {
+    uint8_t bcd = ds1307_get_bcd(reg);
+
+    if ((reg == DS1307_REG_HOURS) && ds1307_is_12hr_mode()) {
+        // 11 -> 12 and 12 -> 11 change pm/am
+        if (((bcd == 0x12) && (!up_down)) || ((bcd == 0x11) && up_down)) {
+            g_reg_data[DS1307_REG_HOURS] ^= 0x20;
+        }
+    }
+    ds1307_set_bcd(reg, ds1307_bcd_step(bcd, _reg_min(reg), _reg_max(reg), up_down));
+}
+
+bool ds1307_advance_second(void) {
+    // BCD carry seconds -> minutes -> hours
+    ds1307_step_field(DS1307_REG_SECONDS, true);
+    if (ds1307_get_bcd(DS1307_REG_SECONDS) != 0x00) {
+        return true;
+    }
+    ds1307_step_field(DS1307_REG_MINUTES, true);
+    if (ds1307_get_bcd(DS1307_REG_MINUTES) != 0x00) {
+        return true;
+    }
+    ds1307_step_field(DS1307_REG_HOURS, true);
+    // Midnight = 00 (24hr) or 12 AM (12hr)
+    return (g_reg_data[DS1307_REG_HOURS] & 0x3F) != (ds1307_is_12hr_mode() ? 0x12 : 0x00);
+}
+
+int8_t ds1307_compare_bcd(uint8_t reg, uint8_t bcd) {
+    // BCD keeps the order of the decimal value, no conversion needed
+    uint8_t value = ds1307_get_bcd(reg);
+    if (value < bcd) {
+        return -1;
+    }
+    return (value > bcd);
+}
+
 uint8_t ds1307_get_seconds() {
     return bcd_to_dec(g_reg_data[DS1307_REG_SECONDS] & 0x7F);
 }
@@ -252,7 +441,7 @@ uint8_t ds1307_get_day_of_month() {
 }
 
 void ds1307_set_day_of_month(uint8_t dom) {
-    if ((dom > 0) && (dom < 32)) { // 1 -> 31
+    if ((dom > 0) && (dom <= cal_days_in_month(ds1307_get_year(), ds1307_get_month()))) { // 1 -> 28/29/30/31
         g_reg_data[DS1307_REG_DAY_OM] = dec_to_bcd(dom);
     }
 }
@@ -360,7 +549,9 @@ void ds1307_switch_to_24hr(void) {
 void ds1307_write_ram(uint8_t addr, uint8_t value) {
     // RAM start at 0x08 - > 0x3F = 56KB
     // so address = 0x08 + addr
-
+    if (addr >= DS1307_RAM_SIZE) {
+        return; // The pointer would wrap to the time registers
+    }
     ds1307_write_addr(DS1307_REG_RAM_ADDR + addr, value);
 }
 
@@ -368,27 +559,105 @@ uint8_t ds1307_read_ram(uint8_t addr) {
     uint8_t data;
     // RAM start at 0x08 - > 0x3F = 56KB
     // so address = 0x08 + addr
+    if (addr >= DS1307_RAM_SIZE) {
+        return 0x00;
+    }
     data = ds1307_read_addr(DS1307_REG_RAM_ADDR + addr);
     return data;
 }
 
+void ds1307_read_ram_block(uint8_t addr, uint8_t* p_data, uint8_t len) {
+    if ((addr >= DS1307_RAM_SIZE) || (len > DS1307_RAM_SIZE - addr)) {
+        return; // The pointer would wrap from 0x3F to 0x00
+    }
+    // Read Continuos =
+    // |S|1101000W|A|0x08+ADDR|A|SR|1101000R|A|DATA0|A|....|DATA_N|NA|P|
+    i2c_start();
+    i2c_send_address(DS1307_SLAVE_ADDR, I2C_ADDRESS_MODE_WRITE);
+    i2c_send_data(DS1307_REG_RAM_ADDR + addr);
+    i2c_restart();
+    i2c_send_address(DS1307_SLAVE_ADDR, I2C_ADDRESS_MODE_READ);
+    while (len != 0) {
+        *p_data++ = i2c_read_data();
+        len--;
+        i2c_send_ack((len != 0) ? I2C_ACK : I2C_NACK); // NACK the last one
+    }
+    i2c_stop();
+}
+
+void ds1307_write_ram_block(uint8_t addr, const uint8_t* p_data, uint8_t len) {
+    if ((addr >= DS1307_RAM_SIZE) || (len > DS1307_RAM_SIZE - addr)) {
+        return; // The pointer would wrap to the time registers (CH stops the clock)
+    }
+    // Write Continuos =
+    // |S|1101000W|A|0x08+ADDR|A|DATA0|A|....|DATA_N|A|P|
+    i2c_start();
+    i2c_send_address(DS1307_SLAVE_ADDR, I2C_ADDRESS_MODE_WRITE);
+    i2c_send_data(DS1307_REG_RAM_ADDR + addr);
+    while (len != 0) {
+        i2c_send_data(*p_data++);
+        len--;
+    }
+    i2c_stop();
+}
+
+#if DS1307_RAM_SHADOW > 0
+void ds1307_ram_load(void) {
+    ds1307_read_ram_block(0x00, g_ram, DS1307_RAM_SHADOW);
+    g_ram_dirty_lo = 0xFF;
+}
+
+uint8_t ds1307_ram_get(uint8_t addr) {
+    if (addr >= DS1307_RAM_SHADOW) {
+        return 0x00;
+    }
+    return g_ram[addr];
+}
+
+void ds1307_ram_set(uint8_t addr, uint8_t value) {
+    if ((addr >= DS1307_RAM_SHADOW) || (g_ram[addr] == value)) {
+        return; // Same value, nothing to write
+    }
+    g_ram[addr] = value;
+    // Grow the dirty range, one block covers all changes
+    if (g_ram_dirty_lo == 0xFF) {
+        g_ram_dirty_lo = addr;
+        g_ram_dirty_hi = addr;
+    } else if (addr < g_ram_dirty_lo) {
+        g_ram_dirty_lo = addr;
+    } else if (addr > g_ram_dirty_hi) {
+        g_ram_dirty_hi = addr;
+    }
+}
+
+void ds1307_ram_flush(void) {
+    if (g_ram_dirty_lo != 0xFF) {
+        ds1307_write_ram_block(g_ram_dirty_lo, &g_ram[g_ram_dirty_lo], g_ram_dirty_hi - g_ram_dirty_lo + 1);
+        g_ram_dirty_lo = 0xFF;
+    }
+}
+#endif
+
 void ds1307_time_formatted(char* p_str_time) {
+    uint8_t seconds = g_reg_data[DS1307_REG_SECONDS] & 0x7F;
+    uint8_t minutes = g_reg_data[DS1307_REG_MINUTES];
+
     if (ds1307_is_12hr_mode()) {
-        // 12h Mode[10] = HH:MM:SSP/A+NULL
-        sprintf(p_str_time, "%.2u:%.2u:%.2u", ds1307_get_hours(), ds1307_get_minutes(), ds1307_get_seconds());
+        // 12h Mode[10] = HH:MM:SSP/A+NULL, register already holds 1 -> 12
+        fmt_time(p_str_time, g_reg_data[DS1307_REG_HOURS] & 0x1F, minutes, seconds, FMT_TIME_24HR);
         if (ds1307_is_pm()) {
             p_str_time[8] = 'P';
         } else {
             p_str_time[8] = 'A';
         }
-        p_str_time[9] = NULL;
     } else {
         // 24h Mode[10] = HH:MM:SS+ +NULL
-        sprintf(p_str_time, "%.2u:%.2u:%.2u ", ds1307_get_hours(), ds1307_get_minutes(), ds1307_get_seconds());
+        fmt_time(p_str_time, g_reg_data[DS1307_REG_HOURS] & 0x3F, minutes, seconds, FMT_TIME_24HR);
     }
 }
 
 void ds1307_date_formatted(char* p_str_date) {
-    // String[9] = MM/DD/YY+NULL
-    sprintf(p_str_date, "%.2u/%.2u/%.2u", ds1307_get_month(), ds1307_get_day_of_month(), ds1307_get_year());
+    // String[9] = MM/DD/YY+NULL or DD/MM/YY+NULL, String[11] = 20YY-MM-DD+NULL
+    fmt_date(p_str_date, g_reg_data[DS1307_REG_YEAR], g_reg_data[DS1307_REG_MONTH],
+            g_reg_data[DS1307_REG_DAY_OM] & 0x3F, DS1307_DATE_LAYOUT);
 }
@@ -33,6 +33,15 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      08/01/14    Initial version
+ * 1.1      10/19/26    DS1307_DATE_LAYOUT
+ *                      BCD field API
+ *                      Single transaction set_clock, set_field
+ *                      advance_second for softrtc.c
+ *                      Month length limits (calendar.c), set_date
+ *                      RAM block read/write, RAM shadow
+ *                      Partial reads with valid mask
+ *                      Fixed RS values for 8.192KHz and 32.768KHz
+ * 1.2      10/19/26    Range checks on the RAM and register blocks
  *********************************************************************/
 
 #ifndef __DS1307_H
@@ -41,21 +50,31 @@
 /** INCLUDES *******************************************************/
 #include <stdint.h>
 #include <stdbool.h>
+#include "format.h"
 
 /** INTERFACE CONFIGURATION ****************************************/
 #define DS1307_SLAVE_ADDR   0b01101000 // Static address
 
 #define DS1307_RAM_SIZE     56 // 56 Bytes of RAM (0x00 -> 0x37)
+#define DS1307_RAM_SHADOW   0  // Bytes from 0x00 mirrored in PIC RAM (0 = no shadow, max DS1307_RAM_SIZE)
+
+#define DS1307_DATE_LAYOUT  FMT_DATE_MDY // FMT_DATE_MDY, FMT_DATE_DMY, FMT_DATE_ISO
 
 #define DS1307_CONF_RS_1HZ      0x00 // 1Hz
 #define DS1307_CONF_RS_4096HZ   0x01 // 4.096 KHz
-#define DS1307_CONF_RS_8192HZ   0x10 // 8.192 KHz
-#define DS1307_CONF_RS_32768HZ  0x11 // 32.768 KHz
+#define DS1307_CONF_RS_8192HZ   0x02 // 8.192 KHz
+#define DS1307_CONF_RS_32768HZ  0x03 // 32.768 KHz
 #define DS1307_CONF_SQWE_OFF    0x00
 #define DS1307_CONF_SQWE_ON     0x01
 #define DS1307_CONF_SQWE_OUT_0  0x00
 #define DS1307_CONF_SQWE_OUT_1  0x01
 
+#define DS1307_VALID_SECONDS    0x01 // ds1307_valid_mask() bits, bit n = register n
+#define DS1307_VALID_TIME       0x07
+#define DS1307_VALID_DATE       0x78
+#define DS1307_VALID_CONTROL    0x80
+#define DS1307_VALID_ALL        0xFF
+
 #define DS1307_SET_AM           0x00
 #define DS1307_SET_PM           0x01
 #define DS1307_HR_MODE_24HR     0x00
@@ -108,9 +127,46 @@ bool ds1307_is_stopped(void);
  */
 void ds1307_get_clock(void);
 /**
- * Set time and clock to device (ctrl is not assigned)
+ * Get a range of registers from device (Only those are updated)
+ * @param first DS1307_REG_SECONDS -> DS1307_REG_CONTROL
+ * @param count Registers to read (first + count <= 8, clamped to the Control register)
+ */
+void ds1307_get_regs(uint8_t first, uint8_t count);
+/**
+ * Get only seconds, minutes and hours from device (3 bytes)
+ */
+void ds1307_read_time(void);
+/**
+ * Get only day of the week, day, month and year from device (4 bytes)
+ */
+void ds1307_read_date(void);
+/**
+ * Get only seconds from device (1 byte)
+ */
+void ds1307_read_seconds(void);
+/**
+ * Get which registers were read from the device
+ * @return DS1307_VALID_* bits
+ */
+uint8_t ds1307_valid_mask(void);
+/**
+ * Mark registers as not read (e.g. after a long sleep)
+ * @param mask DS1307_VALID_* bits
+ */
+void ds1307_invalidate(uint8_t mask);
+/**
+ * Set time and clock to device in one transaction and start it (ctrl is not assigned)
  */
 void ds1307_set_clock(void);
+/**
+ * Write day of the week, day, month and year to the device in one transaction
+ */
+void ds1307_set_date(void);
+/**
+ * Write only one time/date register to the device (Seconds also resets the countdown chain)
+ * @param reg DS1307_REG_SECONDS -> DS1307_REG_YEAR
+ */
+void ds1307_set_field(uint8_t reg);
 /**
  * Configure control byte of device (Direct, No set_clock required)
  * @param out DS1307_CONF_SQWE_OUT_0, DS1307_CONF_SQWE_OUT_1
@@ -123,6 +179,45 @@ void ds1307_set_control(uint8_t out, uint8_t sqwe, uint8_t rs);
  * @return 1 = true = 12hr mode, 0 = false = 24hr mode
  */
 bool ds1307_is_12hr_mode(void);
+/**
+ * Get a time/date field in BCD (CH, 12hr mode and pm bits removed)
+ * @param reg DS1307_REG_SECONDS -> DS1307_REG_YEAR
+ * @return BCD value (Hours 0x01-0x12 in 12hr mode, 0x00-0x23 in 24hr mode)
+ */
+uint8_t ds1307_get_bcd(uint8_t reg);
+/**
+ * Set a time/date field in BCD (Invalid BCD or out of limits is ignored)
+ * @param reg DS1307_REG_SECONDS -> DS1307_REG_YEAR
+ * @param bcd BCD value
+ */
+void ds1307_set_bcd(uint8_t reg, uint8_t bcd);
+/**
+ * Increment or decrement a BCD value with wraparound
+ * @param bcd BCD value
+ * @param lim_dwn Lower limit in BCD
+ * @param lim_up Upper limit in BCD
+ * @param up_down true = increment, false = decrement
+ * @return New BCD value
+ */
+uint8_t ds1307_bcd_step(uint8_t bcd, uint8_t lim_dwn, uint8_t lim_up, bool up_down);
+/**
+ * Increment or decrement a field inside its own limits (pm/am follows in 12hr mode)
+ * @param reg DS1307_REG_SECONDS -> DS1307_REG_YEAR
+ * @param up_down true = increment, false = decrement
+ */
+void ds1307_step_field(uint8_t reg, bool up_down);
+/**
+ * Advance the time one second in the shadow only (No bus access)
+ * @return false = a new day started and the date was not advanced, resync with ds1307_get_clock
+ */
+bool ds1307_advance_second(void);
+/**
+ * Compare a field with a BCD value
+ * @param reg DS1307_REG_SECONDS -> DS1307_REG_YEAR
+ * @param bcd BCD value
+ * @return -1 = field is lower, 0 = equal, 1 = field is greater
+ */
+int8_t ds1307_compare_bcd(uint8_t reg, uint8_t bcd);
 /**
  * Get the seconds
  * @return Seconds (0-59)
@@ -169,8 +264,8 @@ void ds1307_set_day_of_week(uint8_t dow);
  */
 uint8_t ds1307_get_day_of_month();
 /**
- * Set day of the month
- * @param dom Day of the month (1-31)
+ * Set day of the month (Set year and month first)
+ * @param dom Day of the month (1-28/29/30/31)
  */
 void ds1307_set_day_of_month(uint8_t dom);
 /**
@@ -218,24 +313,60 @@ void ds1307_switch_to_12hr(void);
 void ds1307_switch_to_24hr(void);
 /**
  * Write a byte to the DS1307 RAM (56 Bytes)
- * @param addr Address (0x00-0x37)
+ * @param addr Address (0x00-0x37, else nothing is written)
  * @param value Byte to write
  */
 void ds1307_write_ram(uint8_t addr, uint8_t value);
 /**
  * Read a byte from the DS1307 RAM (56 Bytes)
  * @param addr Address (0x00-0x37)
- * @return Read byte
+ * @return Read byte, 0x00 for an address out of range
  */
 uint8_t ds1307_read_ram(uint8_t addr);
+/**
+ * Read consecutive bytes from the DS1307 RAM in one transaction
+ * @param addr First address (0x00-0x37)
+ * @param p_data Pointer to buffer[len]
+ * @param len Bytes to read (addr + len <= DS1307_RAM_SIZE, else nothing is read)
+ */
+void ds1307_read_ram_block(uint8_t addr, uint8_t* p_data, uint8_t len);
+/**
+ * Write consecutive bytes to the DS1307 RAM in one transaction
+ * @param addr First address (0x00-0x37)
+ * @param p_data Pointer to data[len]
+ * @param len Bytes to write (addr + len <= DS1307_RAM_SIZE, else nothing is written)
+ */
+void ds1307_write_ram_block(uint8_t addr, const uint8_t* p_data, uint8_t len);
+#if DS1307_RAM_SHADOW > 0
+/**
+ * Fill the RAM shadow from the device
+ */
+void ds1307_ram_load(void);
+/**
+ * Read a byte from the RAM shadow (No bus access)
+ * @param addr Address (0x00 -> DS1307_RAM_SHADOW-1)
+ * @return Byte
+ */
+uint8_t ds1307_ram_get(uint8_t addr);
+/**
+ * Write a byte to the RAM shadow, it's sent with ds1307_ram_flush()
+ * @param addr Address (0x00 -> DS1307_RAM_SHADOW-1)
+ * @param value Byte
+ */
+void ds1307_ram_set(uint8_t addr, uint8_t value);
+/**
+ * Write the changed range of the RAM shadow in one transaction
+ */
+void ds1307_ram_flush(void);
+#endif
 /**
  * Format time to HH:MM:SS[P/A]+NULL
  * @param p_str_time Pointer to buffer[10]
  */
 void ds1307_time_formatted(char* p_str_time);
 /**
- * Format date to MM/DD/YY+NULL
- * @param p_str_date Pointer to buffer[9]
+ * Format date with DS1307_DATE_LAYOUT (MM/DD/YY+NULL by default)
+ * @param p_str_date Pointer to buffer[9], buffer[11] for FMT_DATE_ISO
  */
 void ds1307_date_formatted(char* p_str_date);
 #endif	/* __DS1307_H */
@@ -0,0 +1,142 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       format.c
+ * Created On:      October 19, 2026, 9:10 AM
+ * Description:     Digit conversions by subtraction, no divide routines
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "format.h"
+
+/** PRIVATE VARIABLES **********************************************/
+// Decimal weights for fmt_u16(), digits are found by subtraction
+static const uint16_t g_pow10[] = {10000, 1000, 100, 10};
+
+/** PRIVATE FUNCTION PROTOTYPES ************************************/
+static char* _fmt_weights(char*, uint16_t, uint8_t);
+
+/** PRIVATE FUNCTION DEFINITIONS ***********************************/
+static char* _fmt_weights(char* p_str, uint16_t value, uint8_t first) {
+    bool lead = true; // Still skipping leading zeros
+
+    for (uint8_t w = first; w < sizeof (g_pow10) / sizeof (g_pow10[0]); w++) {
+        char digit = '0';
+        while (value >= g_pow10[w]) {
+            value -= g_pow10[w];
+            digit++;
+        }
+        if ((digit != '0') || (!lead)) {
+            *p_str++ = digit;
+            lead = false;
+        }
+    }
+    *p_str++ = '0' + (uint8_t) value; // Units are always written
+    *p_str = '\0';
+    return p_str;
+}
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+char* fmt_bcd(char* p_str, uint8_t bcd) {
+    *p_str++ = '0' + (bcd >> 4);
+    *p_str++ = '0' + (bcd & 0x0F);
+    return p_str;
+}
+
+char* fmt_u8(char* p_str, uint8_t value) {
+    // 255 max, start at the 100 weight
+    return _fmt_weights(p_str, value, 2);
+}
+
+char* fmt_u16(char* p_str, uint16_t value) {
+    return _fmt_weights(p_str, value, 0);
+}
+
+char* fmt_time(char* p_str, uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t layout) {
+    char suffix = ' ';
+
+    if (layout == FMT_TIME_12HR) {
+        suffix = 'A';
+        if (hours > 0x11) { // 12 -> 23 = PM
+            suffix = 'P';
+        }
+        if (hours == 0x00) {
+            // 0 (24Hr) = 12 am
+            hours = 0x12;
+        } else if (hours > 0x12) {
+            // 13 -> 23 (24Hr) = hr - 12 (12Hr), BCD subtract with decimal adjust
+            hours -= 0x12;
+            if ((hours & 0x0F) > 0x09) {
+                hours -= 0x06;
+            }
+        }
+    }
+    p_str = fmt_bcd(p_str, hours);
+    *p_str++ = ':';
+    p_str = fmt_bcd(p_str, minutes);
+    *p_str++ = ':';
+    p_str = fmt_bcd(p_str, seconds);
+    *p_str++ = suffix;
+    *p_str = '\0';
+    return p_str;
+}
+
+char* fmt_date(char* p_str, uint8_t year, uint8_t month, uint8_t day, uint8_t layout) {
+    switch (layout) {
+        case FMT_DATE_DMY:
+            p_str = fmt_bcd(p_str, day);
+            *p_str++ = '/';
+            p_str = fmt_bcd(p_str, month);
+            *p_str++ = '/';
+            p_str = fmt_bcd(p_str, year);
+            break;
+        case FMT_DATE_ISO:
+            *p_str++ = '2';
+            *p_str++ = '0';
+            p_str = fmt_bcd(p_str, year);
+            *p_str++ = '-';
+            p_str = fmt_bcd(p_str, month);
+            *p_str++ = '-';
+            p_str = fmt_bcd(p_str, day);
+            break;
+        default: // FMT_DATE_MDY
+            p_str = fmt_bcd(p_str, month);
+            *p_str++ = '/';
+            p_str = fmt_bcd(p_str, day);
+            *p_str++ = '/';
+            p_str = fmt_bcd(p_str, year);
+            break;
+    }
+    *p_str = '\0';
+    return p_str;
+}
@@ -0,0 +1,102 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       format.h
+ * Created On:      October 19, 2026, 9:10 AM
+ * Description:     Number, time and date to ASCII without printf or
+ *                  divisions. BCD values are taken straight from the
+ *                  RTC registers, one nibble per digit.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ *********************************************************************/
+
+#ifndef __FORMAT_H
+#define __FORMAT_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define FMT_TIME_24HR   0 // HH:MM:SS+ +NULL
+#define FMT_TIME_12HR   1 // HH:MM:SSP/A+NULL
+
+#define FMT_DATE_MDY    0 // MM/DD/YY+NULL
+#define FMT_DATE_DMY    1 // DD/MM/YY+NULL
+#define FMT_DATE_ISO    2 // 20YY-MM-DD+NULL
+
+#define FMT_TIME_SIZE   10 // Buffer size for fmt_time()
+#define FMT_DATE_SIZE   11 // Buffer size for fmt_date() (ISO is the longest)
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Write a BCD byte as two ASCII digits (no NULL)
+ * @param p_str Pointer to buffer[2]
+ * @param bcd BCD value (0x00-0x99)
+ * @return Pointer after the last digit
+ */
+char* fmt_bcd(char* p_str, uint8_t bcd);
+/**
+ * Write an unsigned byte without leading zeros+NULL
+ * @param p_str Pointer to buffer[4]
+ * @param value Value (0-255)
+ * @return Pointer to the NULL
+ */
+char* fmt_u8(char* p_str, uint8_t value);
+/**
+ * Write an unsigned word without leading zeros+NULL
+ * @param p_str Pointer to buffer[6]
+ * @param value Value (0-65535)
+ * @return Pointer to the NULL
+ */
+char* fmt_u16(char* p_str, uint16_t value);
+/**
+ * Format a 24hr BCD time
+ * @param p_str Pointer to buffer[FMT_TIME_SIZE]
+ * @param hours Hours in BCD (0x00-0x23)
+ * @param minutes Minutes in BCD (0x00-0x59)
+ * @param seconds Seconds in BCD (0x00-0x59)
+ * @param layout FMT_TIME_24HR, FMT_TIME_12HR
+ * @return Pointer to the NULL
+ */
+char* fmt_time(char* p_str, uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t layout);
+/**
+ * Format a BCD date
+ * @param p_str Pointer to buffer[FMT_DATE_SIZE]
+ * @param year Year in BCD (0x00-0x99)
+ * @param month Month in BCD (0x01-0x12)
+ * @param day Day of the month in BCD (0x01-0x31)
+ * @param layout FMT_DATE_MDY, FMT_DATE_DMY, FMT_DATE_ISO
+ * @return Pointer to the NULL
+ */
+char* fmt_date(char* p_str, uint8_t year, uint8_t month, uint8_t day, uint8_t layout);
+
+#endif // __FORMAT_H
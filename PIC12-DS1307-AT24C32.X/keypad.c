@@ -32,11 +32,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      08/04/14    Initial version
+ * 1.1      10/19/26    MCP23017 INTB on a key change, keypad_is_idle
+ *                      Trace valid keys
  *********************************************************************/
 
 /** INCLUDES *******************************************************/
 #include "keypad.h"
 #include "mcp23017.h"
+#include "trace.h"
 
 /** PRIVATE VARIABLES **********************************************/
 static uint8_t g_old_key; // For debounce function
@@ -58,6 +61,13 @@ void keypad_init(void) {
     mcp23017_write_reg(MCP23017_REG_IODIRB, 0xFF); // IOB configure as input
     mcp23017_write_reg(MCP23017_REG_GPPUB,0xFF); // IOB pull ups on
     mcp23017_write_reg(MCP23017_REG_IPOLB,0xFF); // Invert logic
+#if KEYPAD_INTB
+    mcp23017_write_reg(MCP23017_REG_GPINTENB, 0xFF); // Interrupt on any key
+    mcp23017_write_reg(MCP23017_REG_INTCONB, 0x00); // Against the previous value (Press and release)
+    mcp23017_write_reg(MCP23017_REG_IOCON1,
+            mcp23017_read_reg(MCP23017_REG_IOCON1) | MCP23017_IOCON_ODR); // Pull-up on the uC
+    keypad_scan(); // Reading GPIOB clears a pending interrupt
+#endif
 }
 
 uint8_t keypad_read_key(void) {
@@ -73,6 +83,7 @@ uint8_t keypad_read_key(void) {
         if (key != g_last_valid_key) { // No repeat key
             // A valid key
             g_last_valid_key = key; // Store new valid key
+            TRACE_EVENT(TRACE_EV_KEY, key);
         }
         else{
             key = NULL;
@@ -83,3 +94,7 @@ uint8_t keypad_read_key(void) {
     }
     return key;
 }
+
+bool keypad_is_idle(void) {
+    return (g_old_key == NULL); // The last scan saw no key
+}
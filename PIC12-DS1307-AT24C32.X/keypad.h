@@ -32,6 +32,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      08/04/14    Initial version
+ * 1.1      10/19/26    MCP23017 INTB on a key change, keypad_is_idle
  *********************************************************************/
 
 #ifndef __KEYPAD_H
@@ -41,6 +42,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include "main.h"
 
 /** INTERFACE CONFIGURATION ****************************************/
 #define KEYPAD_KEY_UP       0x01
@@ -49,6 +51,8 @@
 #define KEYPAD_KEY_RIGHT    0x08
 #define KEYPAD_KEY_BL       0x10
 
+#define KEYPAD_INTB         TICKLESS // 1 = MCP23017 INTB (Open drain) goes low on a key change, no polling when idle
+
 /** PUBLIC FUNCTIONS ***********************************************/
 void keypad_init(void);
 /**
@@ -56,5 +60,10 @@ void keypad_init(void);
  * @return NULL = no key, else is a valid key number
  */
 uint8_t keypad_read_key(void);
+/**
+ * With KEYPAD_INTB polling is only needed while a key is down
+ * @return true = no key down, wait for INTB
+ */
+bool keypad_is_idle(void);
 
 #endif // __KEYPAD_H
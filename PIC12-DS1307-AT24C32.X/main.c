@@ -33,6 +33,12 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      07/27/14    Initial version
+ * 1.1      10/19/26    LCD framebuffer, command queue and big digits
+ *                      Formatting without sprintf, BCD field edits
+ *                      SQW refresh, soft RTC, calendar and alarms
+ *                      INTOSC calibration, 32.768KHz timebase
+ *                      Tasks on the tick scheduler, tickless idle
+ *                      Profiling, trace and UART debug commands
  *********************************************************************/
 
 /** INCLUDES *******************************************************/
@@ -44,13 +50,43 @@
 #include "ds1307.h"
 #include "HD44780-IOE.h"
 #include "keypad.h"
-#include <stdio.h>
+#include "format.h"
+#include "softrtc.h"
+#include "calendar.h"
+#include "alarm.h"
+#include "osccal.h"
+#include "tick.h"
+#include "sched.h"
+#include "prof.h"
+#include "trace.h"
+#include "uart.h"
 
 /** DEFINES ********************************************************/
-#define TMR1_PS_1_1  0
-#define TMR1_PS_1_2  1
-#define TMR1_PS_1_4  2
-#define TMR1_PS_1_8  3
+#define CLOCK_BIG_DIGITS 0 // 1 = HH:MM in big digits, seconds on the right
+#define CLOCK_SQW_REFRESH 0 // 1 = Read the clock on the DS1307 1Hz SQW edge (SQW/OUT -> RA4), 0 = Every 500ms
+#define CLOCK_SOFT_RTC    1 // 1 = Advance the time from the tick, read the DS1307 only to resync (softrtc.h)
+#define CLOCK_OSCCAL      0 // 1 = Tune INTOSC and the tick with the DS1307 1Hz SQW at start (SQW/OUT -> RA4, osccal.h)
+#define CLOCK_ALARMS      1 // 1 = Alarms from the DS1307 RAM blink the backlight (alarm.h)
+#define CLOCK_PROF        0 // 1 = Time the ISR, screen refresh, LCD and clock edits (prof.h)
+#define CLOCK_UART        0 // 1 = Debug commands on the EUSART: 'p' = prof report, 't' = trace dump, 'c' = trace clear (uart.h)
+
+#if CLOCK_PROF // Sections
+#define PROF_ID_ISR     0
+#define PROF_ID_SCREEN  1 // update_screen()
+#define PROF_ID_LCD     2 // lcd_task()
+#define PROF_ID_EDIT    3 // update_clock()
+#endif
+
+#if CLOCK_UART
+#define UART_DUMP_PART_SIZE PROF_PART_SIZE // Longest dump part (TRACE_PART_SIZE is 4)
+#endif
+
+#if TIMEBASE_32KHZ && (CLOCK_SQW_REFRESH || CLOCK_OSCCAL)
+#error "SQW/OUT gives 32.768KHz to Timer1, it can't give 1Hz too"
+#endif
+#if LCD_INTERFACE_8BIT
+#error "LCD_INTERFACE_8BIT drives the LCD control pins on IOB, the keypad is on IOB"
+#endif
 
 /** DECLARATIONS ***************************************************/
 typedef enum {
@@ -64,153 +100,345 @@ typedef enum {
 } clk_pos_t;
 
 /** GLOBAL VARIABLES ***********************************************/
-static uint16_t g_reload_value;
-static uint8_t g_counter1;
 static clk_pos_t g_clk_pos;
 static bool g_bl;
+static uint8_t g_task_clock; // Task ids (sched.h)
+static uint8_t g_task_keypad;
+static uint8_t g_task_alarm;
+static uint8_t g_task_display;
+static uint8_t g_task_lcd;
+#if CLOCK_UART
+static uint8_t g_task_uart;
+static uint8_t g_uart_dump; // Command of the dump being sent, 0 = none
+static uint8_t g_uart_part; // Next part of it
+#endif
 
 /** PROTOTYPES *****************************************************/
 #define SetClockTo32Mhz()  OSCCONbits.IRCF = 0b1110; OSCCONbits.SPLLEN = 1
-void init(uint16_t, uint8_t);
-void write_t1(uint16_t);
+void init(uint16_t);
 void update_clock(bool);
-uint8_t adjust_val(uint8_t, uint8_t, uint8_t, bool);
+void update_screen(void);
+void task_clock(void);
+void task_keypad(void);
+void task_alarm(void);
+void task_display(void);
+void task_lcd(void);
+#if CLOCK_UART
+void task_uart(void);
+#endif
+#if CLOCK_ALARMS
+void on_alarm(uint8_t);
+#endif
+#if CLOCK_SQW_REFRESH || CLOCK_OSCCAL
+void sqw_init(void);
+#endif
+#if CLOCK_OSCCAL && !CLOCK_SQW_REFRESH
+void sqw_off(void);
+#endif
+#if KEYPAD_INTB
+void intb_init(void);
+#endif
+#if TICKLESS
+void idle(void);
+#endif
 
 /** CODE DECLARATIONS ****************************************/
 void main(void) {
+#if CLOCK_OSCCAL
+    uint32_t counts; // Timer1 counts in the measured second
+#endif
+
     SetClockTo32Mhz();
+#if TRACE
+    trace_init(); // Records of before the reset are kept
+#endif
 
     i2c_init(I2C_SPEED_STANDARD_100KHZ);
     mcp23017_init(0b000); // Init MCP23017 with the address xxx
     keypad_init();
     //at24c32_init(0b000);
     ds1307_init();
+#if CLOCK_SOFT_RTC && !CLOCK_SQW_REFRESH
+    softrtc_init();
+#endif
     lcd_initialize();
-    init(50000, TMR1_PS_1_8); // 50ms Ticks
+#if CLOCK_BIG_DIGITS
+    lcd_fb_big_digit_load(); // All the segments before the first frame
+#endif
+#if CLOCK_ALARMS
+    alarm_init(cal_ds1307_epoch(), on_alarm);
+#endif
+#if CLOCK_SQW_REFRESH || CLOCK_OSCCAL
+    sqw_init();
+#endif
+#if CLOCK_UART
+    uart_init(); // GIE is set by init()
+#endif
+
+    // Tasks by priority
+#if CLOCK_SQW_REFRESH
+    g_task_clock = sched_add(task_clock, SCHED_EVENT_ONLY); // SQW edge
+#elif CLOCK_SOFT_RTC
+    g_task_clock = sched_add(task_clock, TICK_FROM_MS(1000 / SOFTRTC_TICKS_PER_SECOND));
+#else
+    g_task_clock = sched_add(task_clock, TICK_FROM_MS(500));
+#endif
+#if KEYPAD_INTB
+    g_task_keypad = sched_add(task_keypad, SCHED_EVENT_ONLY); // INTB edge
+#else
+    g_task_keypad = sched_add(task_keypad, TICK_FROM_MS(50));
+#endif
+    g_task_alarm = sched_add(task_alarm, SCHED_EVENT_ONLY);
+    g_task_display = sched_add(task_display, SCHED_EVENT_ONLY);
+    g_task_lcd = sched_add(task_lcd, SCHED_EVENT_ONLY);
+#if CLOCK_UART
+    g_task_uart = sched_add(task_uart, SCHED_EVENT_ONLY); // Received byte
+#endif
+
+#if CLOCK_PROF
+    // A longer ISR loses ticks, a longer task delays the keypad
+    prof_init(PROF_ID_ISR, TICK_STAMP_FROM_US(100));
+    prof_init(PROF_ID_SCREEN, TICK_STAMP_FROM_US(50000));
+    prof_init(PROF_ID_LCD, TICK_STAMP_FROM_US(50000));
+    prof_init(PROF_ID_EDIT, TICK_STAMP_FROM_US(50000));
+#endif
+
+#if CLOCK_OSCCAL
+    counts = osccal_run();
+#if !CLOCK_SQW_REFRESH
+    sqw_off(); // Only for the calibration, the ISR doesn't clear IOCAF4
+#endif
+    init((uint16_t) ((counts + 500) / 1000)); // 1ms Ticks of the measured second, rounded
+#else
+    init(TICK_COUNTS_PER_MS); // 1ms Ticks (62.5ms with TIMEBASE_32KHZ)
+#endif
+#if KEYPAD_INTB
+    intb_init(); // After tick_init(), it writes WPUA
+#endif
 
     for (;;) {
-        ;
+        if (!sched_run()) { // Everything but the tick runs here
+#if TICKLESS
+            idle();
+#endif
+        }
     }
 }
 
-void init(uint16_t load_value, uint8_t prescaler) {
+void init(uint16_t counts_per_ms) {
     // Interrupts Configuration (Only 1 interrupt for this operating system)
     INTCONbits.GIE = 0; // Disable global interrupt
-    PIR1bits.TMR1IF = 0; // Clear interrupt flag
-    PIE1bits.TMR1IE = 1; // Enable interrupt
-    INTCONbits.PEIE = 1; // Timmers are peripherials
-    INTCONbits.GIE = 1; // Enable global interrupt
-
-    // Timer1 configuration
-    T1CONbits.TMR1ON = 0; // Stop Timmer
-    T1CONbits.TMR1CS = 00; // Fosc/4
-    T1CONbits.T1CKPS = prescaler; // 1,2,4,8
-    g_reload_value = 65536 - load_value;
-    write_t1(g_reload_value); // Load value
-    T1CONbits.TMR1ON = 1; // Start timer
-
+    tick_init(counts_per_ms); // Timer1 and its interrupt
     g_bl = 1; // Turn off bl
     g_clk_pos = CLK_POS_HR; // Initial position
-}
-
-void write_t1(uint16_t value) {
-    T1CONbits.TMR1ON = 0; // Stop timer
-
-    // Upload data
-    TMR1H = (uint8_t) (value >> 8);
-    TMR1L = (uint8_t) value;
-
-    T1CONbits.TMR1ON = 1; // Start timer
-}
-
-uint8_t adjust_val(uint8_t value, uint8_t lim_dwn, uint8_t lim_up, bool up_down) {
-    if ((value == lim_up) && (up_down)) {
-        value = lim_dwn;
-    } else if ((value == lim_dwn) && (!up_down)) {
-        value = lim_up;
-    } else if (up_down) {
-        value++;
-    } else {
-        value--;
-    }
-    return value;
+    INTCONbits.GIE = 1; // Enable global interrupt
 }
 
 void update_clock(bool up_down) {
-    uint8_t val;
-    bool pm;
+    uint8_t reg;
+    bool new_second; // The seconds register is written
 
-    ds1307_stop_clock(); // Stop clock
+#if CLOCK_PROF
+    prof_begin(PROF_ID_EDIT);
+#endif
     ds1307_get_clock(); // Sync
+    // Fields are stepped in BCD, no conversions
     switch (g_clk_pos) {
         case CLK_POS_HR:
-            // Check if 12hr or 24hr then update accordly
-            if (ds1307_is_12hr_mode()) {
-                val = ds1307_get_hours();
-                pm = ds1307_is_pm();
-                if (((val == 12) && (!up_down)) || ((val == 11) && up_down)) {
-                    pm = !pm; // Change pm/am
-                }
-                if ((val == 12) && (up_down)) {
-                    val = 1; // Change from 12am/pm to 1am/pm
-                } else if ((val == 1) && (!up_down)) {
-                    val = 12; // Change from 1am/pm to 12am/pm
-                } else if (up_down) {
-                    val++;
-                } else {
-                    val--;
-                }
-                ds1307_set_pm_am(pm); // Set pm/am
-                ds1307_set_hours(val); // Set new hr
-            } else { // 24hr mode
-                val = ds1307_get_hours();
-                val = adjust_val(val, 0, 23, up_down);
-                ds1307_set_hours(val); // Set new hr
-            }
+            reg = DS1307_REG_HOURS; // pm/am follows in 12hr mode
             break;
         case CLK_POS_MIN:
-            val = ds1307_get_minutes();
-            val = adjust_val(val, 0, 59, up_down);
-            ds1307_set_minutes(val);
+            reg = DS1307_REG_MINUTES;
             break;
         case CLK_POS_SEC:
-            val = ds1307_get_seconds();
-            val = adjust_val(val, 0, 59, up_down);
-            ds1307_set_seconds(val);
+            reg = DS1307_REG_SECONDS;
             break;
         case CLK_POS_MON:
-            val = ds1307_get_month();
-            val = adjust_val(val, 1, 12, up_down);
-            ds1307_set_month(val);
+            reg = DS1307_REG_MONTH;
             break;
         case CLK_POS_DAY:
-            val = ds1307_get_day_of_month();
-            val = adjust_val(val, 1, 31, up_down);
-            ds1307_set_day_of_month(val);
+            reg = DS1307_REG_DAY_OM;
             break;
         case CLK_POS_YR:
-            val = ds1307_get_year();
-            val = adjust_val(val, 0, 99, up_down);
-            ds1307_set_year(val);
+            reg = DS1307_REG_YEAR;
             break;
-        case CLK_POS_HR_MOD:
+        default: // CLK_POS_HR_MOD
             if (ds1307_is_12hr_mode() == true) {
                 ds1307_switch_to_24hr();
             } else {
                 ds1307_switch_to_12hr();
             }
+            reg = DS1307_REG_HOURS; // Mode and pm are in hours too
             break;
     }
-    ds1307_set_clock(); // Sync and start clock
-    //ds1307_start_clock(); // Start clock
+    if (g_clk_pos != CLK_POS_HR_MOD) {
+        ds1307_step_field(reg, up_down);
+    }
+    if (reg >= DS1307_REG_DAY_OM) {
+        // No 02/31, and the day of the week follows the date
+        cal_fix_ds1307_date();
+    }
+    new_second = (reg == DS1307_REG_SECONDS);
+    if (ds1307_is_stopped()) {
+        ds1307_set_clock(); // Halted (new battery), write all and start it
+        new_second = true;
+    } else if (reg >= DS1307_REG_DAY_OM) {
+        ds1307_set_date(); // Day, month, year and day of the week
+    } else {
+        ds1307_set_field(reg); // Only the changed register
+    }
+#if CLOCK_SOFT_RTC && !CLOCK_SQW_REFRESH
+    softrtc_set(new_second); // Epoch follows the new time
+#endif
+#if CLOCK_PROF
+    prof_end(PROF_ID_EDIT);
+#endif
 }
 
-void interrupt tmr_isr(void) {
-    write_t1(g_reload_value); // Manual reload timer value
-    g_counter1++;
+#if CLOCK_ALARMS
+void on_alarm(uint8_t id) {
+    g_bl = !g_bl; // Blink the backlight
+}
+#endif
+
+void update_screen(void) {
+    uint8_t time[FMT_TIME_SIZE], date[FMT_DATE_SIZE];
+    char pos[4];
+
+#if CLOCK_PROF
+    prof_begin(PROF_ID_SCREEN);
+#endif
+    ds1307_time_formatted(time);
+    ds1307_date_formatted(date);
+    fmt_u8(pos, g_clk_pos);
+    // Draw the screen, only the changed characters are sent
+#if CLOCK_BIG_DIGITS
+    // |HH.MM P<pos>|
+    // |HH.MM SS    |
+    lcd_fb_big_digit(1, 1, time[0] - '0');
+    lcd_fb_big_digit(1, 4, time[1] - '0');
+    lcd_fb_goto(1, 7);
+    lcd_fb_putc(0xA5); // Middle dot
+    lcd_fb_goto(2, 7);
+    lcd_fb_putc(0xA5);
+    lcd_fb_big_digit(1, 8, time[3] - '0');
+    lcd_fb_big_digit(1, 11, time[4] - '0');
+    lcd_fb_goto(1, 15);
+    lcd_fb_putc(time[8]); // P/A
+    lcd_fb_putc(pos[0]);
+    lcd_fb_goto(2, 15);
+    lcd_fb_putc(time[6]);
+    lcd_fb_putc(time[7]);
+#else
+    lcd_fb_goto(1, 1);
+    lcd_fb_write((uint8_t *) "Time: ");
+    lcd_fb_write(time);
+    lcd_fb_goto(2, 1);
+    lcd_fb_write((uint8_t *) "Date: ");
+    lcd_fb_write(date);
+    lcd_fb_goto(2, 16);
+    lcd_fb_write(pos);
+#endif
+    lcd_fb_flush();
+
+    lcd_backlight(g_bl);
+#if CLOCK_PROF
+    prof_end(PROF_ID_SCREEN);
+#endif
+}
+
+#if CLOCK_SQW_REFRESH || CLOCK_OSCCAL
+void sqw_init(void) {
+    // DS1307 SQW/OUT is open drain, RA4 input with weak pull-up
+    ANSELAbits.ANSA4 = 0; // Digital
+    TRISAbits.TRISA4 = 1; // Input
+    WPUA = 0b00010000; // Pull-up only on RA4
+    OPTION_REGbits.nWPUEN = 0; // Enable weak pull-ups
+    IOCANbits.IOCAN4 = 1; // Falling edge, seconds rollover
+    IOCAFbits.IOCAF4 = 0;
+#if CLOCK_SQW_REFRESH
+    INTCONbits.IOCIE = 1; // GIE is set by init()
+#endif
+
+    ds1307_set_control(DS1307_CONF_SQWE_OUT_1, DS1307_CONF_SQWE_ON, DS1307_CONF_RS_1HZ);
+}
+#endif
 
-    // Call tasks here every 50ms
-    switch (keypad_read_key()) {
+#if CLOCK_OSCCAL && !CLOCK_SQW_REFRESH
+void sqw_off(void) {
+    // A pending IOCAF4 would keep IOCIF set once IOCIE is set for INTB
+    IOCANbits.IOCAN4 = 0;
+    IOCAFbits.IOCAF4 = 0;
+    ds1307_set_control(DS1307_CONF_SQWE_OUT_1, DS1307_CONF_SQWE_OFF, DS1307_CONF_RS_1HZ);
+}
+#endif
+
+#if KEYPAD_INTB
+void intb_init(void) {
+    // MCP23017 INTB is open drain, RA3 input with weak pull-up (MCLRE = OFF)
+    TRISAbits.TRISA3 = 1;
+    WPUAbits.WPUA3 = 1;
+    OPTION_REGbits.nWPUEN = 0;
+    IOCANbits.IOCAN3 = 1; // Falling edge, a key changed
+    IOCAFbits.IOCAF3 = 0;
+    INTCONbits.IOCIE = 1;
+}
+#endif
+
+#if TICKLESS
+void idle(void) {
+    uint16_t ticks;
+
+    // GIE = 0 so no task becomes ready between the check and the sleep,
+    // an interrupt still wakes up the core and is served after GIE = 1
+    INTCONbits.GIE = 0;
+    ticks = sched_next();
+    if (ticks != 0) {
+        tick_set_span((ticks < TICK_MAX_SPAN) ? (uint8_t) ticks : TICK_MAX_SPAN);
+#if TIMEBASE_32KHZ
+        if (!CLOCK_UART || uart_is_idle()) { // The EUSART stops in sleep too
+            SLEEP(); // Timer1 is asynchronous, Fosc/4 stops so it only saves the ticks
+            NOP();
+        }
+#endif
+    }
+    INTCONbits.GIE = 1;
+}
+#endif
+
+void task_clock(void) {
+#if CLOCK_SQW_REFRESH
+    // SQW falling edge, seconds just rolled over
+    ds1307_read_time();
+    if ((ds1307_get_bcd(DS1307_REG_SECONDS) | ds1307_get_bcd(DS1307_REG_MINUTES)) == 0x00) {
+        ds1307_read_date(); // New hour, the date could have changed
+    }
+#if CLOCK_ALARMS
+    alarm_tick(cal_ds1307_epoch());
+#endif
+#elif CLOCK_SOFT_RTC
+    // The time advances in RAM, redraw on each new second
+    if (!softrtc_tick()) {
+        return;
+    }
+#if CLOCK_ALARMS
+    alarm_tick(softrtc_epoch());
+#endif
+#else
+    ds1307_get_clock(); // Every 500ms
+#if CLOCK_ALARMS
+    alarm_tick(cal_ds1307_epoch());
+#endif
+#endif
+    sched_ready(g_task_alarm);
+    sched_ready(g_task_display);
+}
+
+void task_keypad(void) {
+    uint8_t key;
+
+    key = keypad_read_key();
+    switch (key) {
         case KEYPAD_KEY_UP:
             update_clock(true);
             break;
@@ -235,29 +463,123 @@ void interrupt tmr_isr(void) {
             g_bl = !g_bl;
             break;
     }
+    if (key) {
+        sched_ready(g_task_display); // Show the change now
+    }
+#if KEYPAD_INTB
+    // Poll for the debounce only while a key is down
+    sched_set_period(g_task_keypad, keypad_is_idle() ? SCHED_EVENT_ONLY : TICK_FROM_MS(50));
+#endif
+}
+
+void task_alarm(void) {
+#if CLOCK_ALARMS
+    alarm_task(); // Fires the due alarm, if any
+#endif
+}
+
+void task_display(void) {
+    update_screen();
+    sched_ready(g_task_lcd);
+}
+
+void task_lcd(void) {
+#if CLOCK_PROF
+    prof_begin(PROF_ID_LCD);
+    lcd_task(); // Up to LCD_QUEUE_DRAIN_MAX commands
+    prof_end(PROF_ID_LCD);
+#else
+    lcd_task(); // Up to LCD_QUEUE_DRAIN_MAX commands
+#endif
+#if LCD_QUEUE_SIZE > 0
+    // One entry is always free. Cells left dirty by a full queue go
+    // in the room that was just made, not a frame later.
+    if ((lcd_queue_free() != LCD_QUEUE_SIZE - 1) || !lcd_fb_flush()) {
+        sched_ready(g_task_lcd); // More to send, after the higher priority tasks
+    }
+#endif
+}
+
+#if CLOCK_UART
+void task_uart(void) {
+    uint8_t c, len;
+    uint8_t part[UART_DUMP_PART_SIZE];
+
+    while (uart_getc(&c)) {
+        switch (c) {
+#if CLOCK_PROF
+            case 'p':
+                g_uart_dump = c; // Replaces the dump being sent
+                g_uart_part = 0;
+                break;
+#endif
+#if TRACE
+            case 't':
+                g_uart_dump = c;
+                g_uart_part = 0;
+                break;
+            case 'c':
+                trace_clear();
+                break;
+#endif
+        }
+    }
 
-    // Call tasks here every x
-    if (g_counter1 == 10) { // 500ms
-        uint8_t time[10], date[10], pos[2];
-
-        ds1307_get_clock();
-        ds1307_time_formatted(time);
-        ds1307_date_formatted(date);
-        lcd_goto(1, 1);
-        lcd_write((uint8_t *) "Time: ");
-        lcd_goto(1, 7);
-        lcd_write(time);
-        lcd_goto(2, 1);
-        lcd_write((uint8_t *) "Date: ");
-        lcd_goto(2, 7);
-        lcd_write(date);
-        lcd_goto(2, 16);
-        sprintf(pos, "%u", g_clk_pos);
-        lcd_write(pos);
-
-        lcd_backlight(g_bl);
-        g_counter1 = 0;
+    // Whole parts while the ring has room, the other tasks run meanwhile
+    while (g_uart_dump != 0) {
+        if (uart_tx_free() < UART_DUMP_PART_SIZE) {
+            sched_ready(g_task_uart); // The ISR makes room, after the other tasks
+            return;
+        }
+        len = 0;
+#if CLOCK_PROF
+        if (g_uart_dump == 'p') {
+            len = prof_report_next(&g_uart_part, (char*) part);
+        }
+#endif
+#if TRACE
+        if (g_uart_dump == 't') {
+            len = trace_dump_next(&g_uart_part, part);
+        }
+#endif
+        if (len == 0) {
+            g_uart_dump = 0; // Complete
+        } else {
+            uart_write(part, len);
+        }
     }
+}
+#endif
+
+void interrupt tmr_isr(void) {
+    uint8_t ticks;
 
-    PIR1bits.TMR1IF = 0; // Clear interrupt flag
-} //This return will be a "retfie fast"
\ No newline at end of file
+#if CLOCK_PROF
+    prof_begin(PROF_ID_ISR); // Context save is not included
+#endif
+    // Only flags here, the work is done by the tasks
+#if CLOCK_SQW_REFRESH
+    if (IOCAFbits.IOCAF4) { // SQW falling edge
+        IOCAFbits.IOCAF4 = 0; // Clear edge flag (IOCIF follows)
+        sched_ready(g_task_clock);
+    }
+#endif
+#if KEYPAD_INTB
+    if (IOCAFbits.IOCAF3) { // MCP23017 INTB falling edge
+        IOCAFbits.IOCAF3 = 0;
+        sched_ready(g_task_keypad);
+    }
+#endif
+#if CLOCK_UART
+    if (uart_isr()) {
+        sched_ready(g_task_uart);
+    }
+#endif
+    ticks = tick_isr();
+    if (ticks != 0) {
+        sched_tick(ticks);
+    }
+#if CLOCK_PROF
+    prof_end(PROF_ID_ISR);
+#endif
+} //This return will be a "retfie fast"
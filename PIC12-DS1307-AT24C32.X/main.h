@@ -33,6 +33,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      07/27/14    Initial version
+ * 1.1      10/19/26    Timebase selection, TICKS_PER_SECOND
+ * 1.2      10/19/26    TICKLESS
+ * 1.3      10/19/26    TRACE
  *********************************************************************/
 
 #ifndef __MAIN_H
@@ -48,4 +51,13 @@
 #define _XTAL_FREQ (32000000UL)	// Oscillator frequency in Hz
 #define _OSC_PER_INST (4)       // Number of oscillations per instruction
 
+#define TIMEBASE_32KHZ  0       // 1 = Timer1 clocked by the DS1307 32.768KHz SQW/OUT on RA5 (T1CKI)
+#if TIMEBASE_32KHZ
+#define TICKS_PER_SECOND (16)   // 62.5ms, 32768 / TICKS_PER_SECOND must be a multiple of 256
+#else
+#define TICKS_PER_SECOND (20)   // 50ms
+#endif
+#define TICKLESS        0       // 1 = Stretch the tick to the next due task when idle (Sleeps with TIMEBASE_32KHZ)
+#define TRACE           0       // 1 = Driver events in a RAM ring buffer (trace.h)
+
 #endif
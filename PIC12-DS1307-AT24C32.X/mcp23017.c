@@ -33,6 +33,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      07/29/14    Initial version
+ * 1.1      10/19/26    Added burst write functions
  *********************************************************************/
 
 /** INCLUDES *******************************************************/
@@ -80,3 +81,18 @@ uint8_t mcp23017_read_reg(uint8_t reg_address) {
 
     return value;
 }
+
+void mcp23017_burst_start(uint8_t reg_address) {
+    // Write Burst = |S|DIR+W|ADDR|DIN0|DIN1|...|DINn|P|
+    i2c_start();
+    i2c_send_address(g_slave_address_7b, I2C_ADDRESS_MODE_WRITE);
+    i2c_send_data(reg_address);
+}
+
+void mcp23017_burst_write(uint8_t value) {
+    i2c_send_data(value);
+}
+
+void mcp23017_burst_stop(void) {
+    i2c_stop();
+}
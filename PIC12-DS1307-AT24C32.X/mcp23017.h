@@ -33,6 +33,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * Rev.     Date        Comment
  * 1.0      07/29/14    Initial version
+ * 1.1      10/19/26    Added IOCON bits and burst write functions
  *********************************************************************/
 
 #ifndef __MCP23017_H
@@ -70,6 +71,15 @@ typedef enum {
     MCP23017_REG_OLATB
 } mcp23017_registers_t;
 
+// IOCON register bits
+#define MCP23017_IOCON_BANK     0x80 // 1 = Registers separated by port
+#define MCP23017_IOCON_MIRROR   0x40 // 1 = INTA and INTB pins connected
+#define MCP23017_IOCON_SEQOP    0x20 // 1 = Byte mode (address pointer doesn't increment)
+#define MCP23017_IOCON_DISSLW   0x10 // 1 = SDA slew rate disabled
+#define MCP23017_IOCON_HAEN     0x08 // 1 = Hardware address enable (MCP23S17 only)
+#define MCP23017_IOCON_ODR      0x04 // 1 = INT pins as open-drain
+#define MCP23017_IOCON_INTPOL   0x02 // 1 = INT pins active-high
+
 
 /** PUBLIC FUNCTIONS ***********************************************/
 /**
@@ -94,6 +104,24 @@ void mcp23017_write_reg(uint8_t reg_address, uint8_t value);
  * @return The value read from the register
  */
 uint8_t mcp23017_read_reg(uint8_t reg_address);
+/**
+ * Start a burst write at a specific register address, the transaction
+ * stays open until mcp23017_burst_stop() is called.
+ * In byte mode (IOCON.SEQOP = 1) with IOCON.BANK = 0 the address pointer
+ * toggles between the A/B pair of the register (GPIOA, GPIOB, GPIOA, ...),
+ * in sequential mode it increments after every byte.
+ * @param reg_address Address of the first register
+ */
+void mcp23017_burst_start(uint8_t reg_address);
+/**
+ * Write the next byte of an open burst
+ * @param value Value to write
+ */
+void mcp23017_burst_write(uint8_t value);
+/**
+ * Finish an open burst
+ */
+void mcp23017_burst_stop(void);
 
 #endif	/* __MCP23017_H */
 
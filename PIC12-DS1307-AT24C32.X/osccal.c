@@ -0,0 +1,139 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       osccal.c
+ * Created On:      October 19, 2026, 4:05 PM
+ * Description:     SQW edge polling and OSCTUNE search
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    SQW edge timeout
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "main.h"
+#include "osccal.h"
+
+/** PRIVATE FUNCTION PROTOTYPES ************************************/
+static bool _wait_edge(uint8_t*);
+static uint32_t _measure(void);
+static uint32_t _error(uint32_t);
+
+/** PRIVATE FUNCTION DEFINITIONS ***********************************/
+static bool _wait_edge(uint8_t* p_overflows) {
+    // IOCAN4 is set, the flag is polled (GIE = 0), Timer1 is running
+    IOCAFbits.IOCAF4 = 0;
+    while (!IOCAFbits.IOCAF4) {
+        if (PIR1bits.TMR1IF) {
+            PIR1bits.TMR1IF = 0;
+            if (++(*p_overflows) > OSCCAL_TIMEOUT_OVERFLOWS) {
+                return false; // No SQW (DS1307 missing or SQW disabled)
+            }
+        }
+    }
+    return true;
+}
+
+static uint32_t _measure(void) {
+    uint8_t overflows = 0;
+    uint32_t counts;
+
+    T1CONbits.TMR1ON = 0;
+    T1CONbits.TMR1CS = 0b00; // Fosc/4
+    T1CONbits.T1CKPS = 0b11; // 1:8
+    TMR1H = 0;
+    TMR1L = 0;
+    PIR1bits.TMR1IF = 0;
+    T1CONbits.TMR1ON = 1; // Runs during the first wait too, for the timeout
+
+    if (!_wait_edge(&overflows)) {
+        T1CONbits.TMR1ON = 0;
+        return 0;
+    }
+    // Restart the count, a few cycles more latency than the stop (< 1 count)
+    TMR1H = 0;
+    TMR1L = 0;
+    PIR1bits.TMR1IF = 0;
+    overflows = 0;
+    if (!_wait_edge(&overflows)) {
+        T1CONbits.TMR1ON = 0;
+        return 0;
+    }
+    T1CONbits.TMR1ON = 0;
+    if (PIR1bits.TMR1IF) { // Overflow right before the edge
+        PIR1bits.TMR1IF = 0;
+        overflows++;
+    }
+    counts = ((uint32_t) overflows << 16) | ((uint16_t) TMR1H << 8) | TMR1L;
+    return counts;
+}
+
+static uint32_t _error(uint32_t counts) {
+    if (counts > OSCCAL_COUNTS_PER_SECOND) {
+        return counts - OSCCAL_COUNTS_PER_SECOND;
+    }
+    return OSCCAL_COUNTS_PER_SECOND - counts;
+}
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+uint32_t osccal_run(void) {
+    int8_t tune, dir;
+    int8_t best_tune;
+    uint32_t counts, best_counts;
+
+    // OSCTUNE<5:0> is two's complement, 011111 = max frequency
+    tune = OSCTUNEbits.TUN;
+    if (tune & 0x20) {
+        tune |= 0xC0;
+    }
+    best_tune = tune;
+    best_counts = _measure();
+    if (best_counts == 0) {
+        return OSCCAL_COUNTS_PER_SECOND; // No SQW, nominal (TICK_COUNTS_PER_MS)
+    }
+    dir = (best_counts > OSCCAL_COUNTS_PER_SECOND) ? -1 : 1; // Too fast = tune down
+
+    // Step while the error gets smaller
+    for (uint8_t s = 0; s < OSCCAL_MAX_STEPS; s++) {
+        tune += dir;
+        if ((tune < -32) || (tune > 31)) {
+            break;
+        }
+        OSCTUNEbits.TUN = (uint8_t) tune;
+        counts = _measure();
+        if ((counts == 0) || (_error(counts) >= _error(best_counts))) {
+            break; // Passed the closest value (Or the SQW stopped)
+        }
+        best_tune = tune;
+        best_counts = counts;
+    }
+    OSCTUNEbits.TUN = (uint8_t) best_tune;
+    return best_counts;
+}
@@ -0,0 +1,67 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       osccal.h
+ * Created On:      October 19, 2026, 4:05 PM
+ * Description:     INTOSC calibration against the DS1307 1Hz SQW.
+ *                  Timer1 (Fosc/4, 1:8) counts one SQW period and
+ *                  OSCTUNE is stepped to the closest value, the rest
+ *                  of the error is returned for the tick reload.
+ *                  SQW/OUT -> RA4 with 1Hz enabled (sqw_init in main.c)
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    SQW edge timeout
+ *********************************************************************/
+
+#ifndef __OSCCAL_H
+#define __OSCCAL_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define OSCCAL_COUNTS_PER_SECOND    (_XTAL_FREQ / _OSC_PER_INST / 8) // Timer1 counts in 1s with an exact INTOSC
+#define OSCCAL_MAX_STEPS            8 // OSCTUNE steps tried after the first measure (1s each)
+#define OSCCAL_TIMEOUT_OVERFLOWS    30 // Timer1 overflows (65.5ms each) waiting for a SQW edge, ~2s
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Tune INTOSC (Blocking 2 -> OSCCAL_MAX_STEPS+2 seconds, call with GIE = 0)
+ * Timer1 is left stopped and must be configured again.
+ * Without SQW edges it gives up after the first edge wait that times out
+ * (OSCCAL_TIMEOUT_OVERFLOWS + 1 Timer1 overflows, ~2s) and leaves OSCTUNE unchanged.
+ * @return Timer1 counts (Fosc/4, 1:8) in one second with the final OSCTUNE,
+ * OSCCAL_COUNTS_PER_SECOND without SQW
+ */
+uint32_t osccal_run(void);
+
+#endif // __OSCCAL_H
@@ -35,13 +35,18 @@
  * 1.0      07/27/14    Initial version
  * 1.1      07/29/14    Updated i2c_read_data() and added i2c_send_ack()
  * 1.2      07/30/14    Added i2c_read_ack() and Updated some functions
+ * 1.3      10/19/26    Trace events (trace.h)
  *********************************************************************/
 
 /** INCLUDES *******************************************************/
 #include "pic12f1840_i2c.h"
 #include "main.h"
+#include "trace.h"
 
 /** PRIVATE VARIABLES **********************************************/
+#if TRACE
+static bool g_tx; // Last operation was a byte write, ACKSTAT is its answer
+#endif
 
 /** PRIVATE FUNCTION PROTOTYPES ************************************/
 
@@ -77,6 +82,12 @@ void i2c_wait(void) {
     // Wait for flags go idle (Start, Repeat Start, Stop, Receive, Acknowledge)
     // and wait for transmit to finish
     while ((SSP1CON2 & 0x1F) || (SSPSTATbits.R_nW));
+#if TRACE
+    if (g_tx && SSP1CON2bits.ACKSTAT) {
+        TRACE_EVENT(TRACE_EV_I2C_NACK, SSPBUF); // Still the byte sent
+    }
+    g_tx = false;
+#endif
 }
 
 void i2c_start(void) {
@@ -91,6 +102,7 @@ void i2c_restart(void) {
 
 void i2c_stop(void) {
     i2c_wait();
+    TRACE_EVENT(TRACE_EV_I2C_STOP, 0);
     SSP1CON2bits.PEN = 1; // Send Stop sequence
 }
 
@@ -109,12 +121,19 @@ void i2c_send_address(uint8_t address, bool mode) {
     i2c_wait();
     address <<= 1; // Shift 1 bit to the left
     address += mode; // Add the R/W bit
+    TRACE_EVENT(TRACE_EV_I2C_START, address); // Start or restart of a transfer
     SSPBUF = address; // Send new address
+#if TRACE
+    g_tx = true;
+#endif
 }
 
 void i2c_send_data(uint8_t data) {
     i2c_wait();
     SSPBUF = data; // Send data
+#if TRACE
+    g_tx = true;
+#endif
 }
 
 uint8_t i2c_read_data(void) {
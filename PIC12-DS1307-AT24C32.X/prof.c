@@ -0,0 +1,148 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       prof.c
+ * Created On:      October 19, 2026, 9:00 PM
+ * Description:     Section counters and the text report
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Report in parts, GIE is restored
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "main.h"
+#include "prof.h"
+#include "tick.h"
+#include "format.h"
+
+/** PRIVATE DEFINES ************************************************/
+#define PROF_PARTS  3 // Report parts per section
+
+/** PRIVATE VARIABLES **********************************************/
+typedef struct {
+    uint16_t start; // tick_stamp() of prof_begin()
+    uint16_t budget;
+    uint16_t count; // Stops at 0xFFFF, so sum can't overflow
+    uint16_t min;
+    uint16_t max;
+    uint32_t sum; // For the average
+    uint8_t overruns; // Stops at 0xFF
+} prof_section_t;
+
+static prof_section_t g_section[PROF_SECTIONS];
+
+/** PRIVATE FUNCTION PROTOTYPES ************************************/
+static char* _put_field(char*, char, uint16_t);
+
+/** PRIVATE FUNCTION DEFINITIONS ***********************************/
+static char* _put_field(char* p_str, char name, uint16_t value) {
+    *p_str++ = ' ';
+    *p_str++ = name;
+    return fmt_u16(p_str, value);
+}
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+void prof_init(uint8_t id, uint16_t budget) {
+    prof_section_t* p_sec = &g_section[id];
+    bool gie = INTCONbits.GIE;
+
+    INTCONbits.GIE = 0; // The ISR section can be running
+    p_sec->budget = budget;
+    p_sec->count = 0;
+    p_sec->min = 0xFFFF;
+    p_sec->max = 0;
+    p_sec->sum = 0;
+    p_sec->overruns = 0;
+    INTCONbits.GIE = gie;
+}
+
+void prof_begin(uint8_t id) {
+    g_section[id].start = tick_stamp();
+}
+
+void prof_end(uint8_t id) {
+    uint16_t t = tick_stamp();
+    prof_section_t* p_sec = &g_section[id];
+
+    t -= p_sec->start; // Wrap safe
+    if (t < p_sec->min) {
+        p_sec->min = t;
+    }
+    if (t > p_sec->max) {
+        p_sec->max = t;
+    }
+    if (t > p_sec->budget && p_sec->overruns != 0xFF) {
+        p_sec->overruns++;
+    }
+    if (p_sec->count != 0xFFFF) {
+        p_sec->count++;
+        p_sec->sum += t;
+    }
+}
+
+uint8_t prof_report_next(uint8_t* p_part, char* p_buf) {
+    prof_section_t sec;
+    uint8_t id = *p_part / PROF_PARTS;
+    char* p_str = p_buf;
+    bool gie = INTCONbits.GIE;
+
+    if (id >= PROF_SECTIONS) {
+        return 0;
+    }
+    INTCONbits.GIE = 0; // Copy, the ISR section could change in the middle
+    sec = g_section[id];
+    INTCONbits.GIE = gie;
+    switch ((*p_part)++ % PROF_PARTS) {
+        case 0:
+            *p_str++ = '0' + id;
+            p_str = _put_field(p_str, 'n', sec.count);
+            if (sec.count == 0) {
+                (*p_part)++; // No times
+            }
+            break;
+        case 1:
+            if (sec.count != 0) {
+                p_str = _put_field(p_str, 'm', sec.min); // Short names, every byte is sent
+                p_str = _put_field(p_str, 'M', sec.max);
+                p_str = _put_field(p_str, 'a', (uint16_t) (sec.sum / sec.count));
+                break;
+            }
+            (*p_part)++; // Cleared since the first part, end the line now
+            // no break
+        default:
+            p_str = _put_field(p_str, 'o', sec.overruns);
+            *p_str++ = '\r';
+            *p_str++ = '\n';
+            break;
+    }
+    return (uint8_t) (p_str - p_buf);
+}
@@ -0,0 +1,84 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       prof.h
+ * Created On:      October 19, 2026, 9:00 PM
+ * Description:     Execution time of the ISR and code sections with the
+ *                  tick_stamp() Timer1 counts (1us with Fosc/4).
+ *                  Times are wall time, a section in the main loop
+ *                  includes the interrupts served inside it.
+ *                  Report line = "<id> n<count> m<min> M<max> a<avg> o<overruns>\r\n"
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Report in parts, GIE is restored
+ *********************************************************************/
+
+#ifndef __PROF_H
+#define __PROF_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define PROF_SECTIONS   4 // Section ids 0 -> PROF_SECTIONS-1, 15 bytes of RAM each
+
+#define PROF_NO_BUDGET  0xFFFF // Never an overrun
+#define PROF_PART_SIZE  22 // Buffer of prof_report_next(), " m<min> M<max> a<avg>"+NULL
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Clear the counters of a section and set its budget
+ * @param id Section (0 -> PROF_SECTIONS-1)
+ * @param budget Counts, a longer run is an overrun (PROF_NO_BUDGET = none)
+ */
+void prof_init(uint8_t id, uint16_t budget);
+/**
+ * Start timing a section (ISR and main loop, a section is used only by one of them)
+ * @param id Section
+ */
+void prof_begin(uint8_t id);
+/**
+ * Stop timing a section and update its counters
+ * @param id Section
+ */
+void prof_end(uint8_t id);
+/**
+ * Get the next part of the report, so it's sent in chunks without waiting.
+ * A line is "<id> n<count>", " m<min> M<max> a<avg>" and " o<overruns>\r\n",
+ * each part reads the counters again (Main loop)
+ * @param p_part Pointer to the part number, set to 0 to start a report
+ * @param p_buf Pointer to buffer[PROF_PART_SIZE]
+ * @return Chars in the buffer, 0 = the report is complete
+ */
+uint8_t prof_report_next(uint8_t* p_part, char* p_buf);
+
+#endif // __PROF_H
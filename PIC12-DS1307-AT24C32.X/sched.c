@@ -0,0 +1,146 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       sched.c
+ * Created On:      October 19, 2026, 7:00 PM
+ * Description:     Task tables, countdowns and ready bits
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Ticks per call, sched_next
+ * 1.2      10/19/26    Trace task entry/exit
+ * 1.3      10/19/26    Bound check on sched_add()
+ * 1.4      10/19/26    Late ticks carried to the next period
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "main.h"
+#include "sched.h"
+#include "trace.h"
+
+/** PRIVATE VARIABLES **********************************************/
+static sched_task_t g_task[SCHED_MAX_TASKS];
+static uint16_t g_period[SCHED_MAX_TASKS];
+static volatile uint16_t g_countdown[SCHED_MAX_TASKS];
+static volatile uint8_t g_ready; // Bit n = task n is ready
+static uint8_t g_tasks; // Registered tasks
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+uint8_t sched_add(sched_task_t task, uint16_t period) {
+    uint8_t id;
+
+    if (g_tasks >= SCHED_MAX_TASKS) {
+        return SCHED_NO_TASK; // Raise SCHED_MAX_TASKS
+    }
+    id = g_tasks++;
+    g_task[id] = task;
+    g_period[id] = period;
+    g_countdown[id] = period;
+    return id;
+}
+
+void sched_set_period(uint8_t id, uint16_t period) {
+    bool gie = INTCONbits.GIE;
+
+    if (id >= g_tasks) {
+        return;
+    }
+    INTCONbits.GIE = 0; // Both change together for sched_tick()
+    g_period[id] = period;
+    g_countdown[id] = period;
+    INTCONbits.GIE = gie;
+}
+
+void sched_ready(uint8_t id) {
+    bool gie = INTCONbits.GIE;
+
+    if (id >= g_tasks) {
+        return;
+    }
+    INTCONbits.GIE = 0; // Read-modify-write, the ISR sets bits too
+    g_ready |= (uint8_t) (1 << id);
+    INTCONbits.GIE = gie;
+}
+
+void sched_tick(uint8_t ticks) {
+    uint8_t bit = 0x01;
+    uint8_t late;
+
+    for (uint8_t id = 0; id < g_tasks; id++) {
+        if (g_period[id] != SCHED_EVENT_ONLY) {
+            // A period set during a long span is due at its end
+            if (g_countdown[id] <= ticks) {
+                // Ticks past the deadline (Late ISR, clamped span) are
+                // taken from the next period, so the task doesn't drift
+                late = ticks - (uint8_t) g_countdown[id];
+                g_countdown[id] = (late < g_period[id]) ? g_period[id] - late : 1;
+                g_ready |= bit;
+            } else {
+                g_countdown[id] -= ticks;
+            }
+        }
+        bit <<= 1;
+    }
+}
+
+uint16_t sched_next(void) {
+    uint16_t next = SCHED_NEVER;
+
+    if (g_ready != 0) {
+        return 0;
+    }
+    for (uint8_t id = 0; id < g_tasks; id++) {
+        if ((g_period[id] != SCHED_EVENT_ONLY) && (g_countdown[id] < next)) {
+            next = g_countdown[id];
+        }
+    }
+    return next;
+}
+
+bool sched_run(void) {
+    uint8_t bit = 0x01;
+
+    if (g_ready == 0) {
+        return false;
+    }
+    for (uint8_t id = 0; id < g_tasks; id++) {
+        if (g_ready & bit) {
+            INTCONbits.GIE = 0;
+            g_ready &= (uint8_t) ~bit;
+            INTCONbits.GIE = 1;
+            TRACE_EVENT(TRACE_EV_TASK_ENTER, id);
+            g_task[id](); // Run to completion
+            TRACE_EVENT(TRACE_EV_TASK_EXIT, id);
+            return true;
+        }
+        bit <<= 1;
+    }
+    return false;
+}
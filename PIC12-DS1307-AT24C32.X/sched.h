@@ -0,0 +1,95 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       sched.h
+ * Created On:      October 19, 2026, 7:00 PM
+ * Description:     Run to completion scheduler. The ISR only counts
+ *                  the periods down and sets ready bits, the tasks run
+ *                  from the main loop. Lower id = higher priority.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Ticks per call, sched_next
+ * 1.2      10/19/26    SCHED_NO_TASK
+ *********************************************************************/
+
+#ifndef __SCHED_H
+#define __SCHED_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define SCHED_MAX_TASKS     6 // 1 -> 8, 6 bytes of RAM each
+
+#define SCHED_EVENT_ONLY    0 // Period of a task that only runs with sched_ready()
+#define SCHED_NEVER         0xFFFF // sched_next() with only event tasks
+#define SCHED_NO_TASK       0xFF // sched_add() with SCHED_MAX_TASKS registered
+
+typedef void (*sched_task_t)(void);
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Register a task (Before GIE is set), the first one has the highest priority
+ * @param task Function to run
+ * @param period Ticks between runs, SCHED_EVENT_ONLY = only with sched_ready()
+ * @return Task id, SCHED_NO_TASK = no free slot (Ignored by the other functions)
+ */
+uint8_t sched_add(sched_task_t task, uint16_t period);
+/**
+ * Change the period of a task, it's counted from now
+ * @param id Task id
+ * @param period Ticks between runs, SCHED_EVENT_ONLY = only with sched_ready()
+ */
+void sched_set_period(uint8_t id, uint16_t period);
+/**
+ * Make a task ready (ISR and main loop safe)
+ * @param id Task id
+ */
+void sched_ready(uint8_t id);
+/**
+ * Call this function from the ISR on every tick_isr() period
+ * @param ticks Ticks in the period (More than 1 with tickless idle)
+ */
+void sched_tick(uint8_t ticks);
+/**
+ * Ticks until the next periodic task is due, counting the current tick
+ * (Call with GIE = 0 so nothing becomes ready after the check)
+ * @return 0 = a task is ready, SCHED_NEVER = only event tasks
+ */
+uint16_t sched_next(void);
+/**
+ * Call this function from the main loop, runs the highest priority ready task
+ * @return true = a task was run, false = nothing is ready
+ */
+bool sched_run(void);
+
+#endif // __SCHED_H
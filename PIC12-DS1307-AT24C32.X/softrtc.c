@@ -0,0 +1,120 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       softrtc.c
+ * Created On:      October 19, 2026, 11:20 AM
+ * Description:     Seconds counted from the tick, DS1307 read only to resync
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Epoch counter
+ *                      Time only resync every N minutes
+ * 1.2      10/19/26    Resync keeps the phase while the seconds agree
+ *                      softrtc_set keeps it unless the seconds were written
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "main.h"
+#include "softrtc.h"
+#include "ds1307.h"
+#include "calendar.h"
+
+/** PRIVATE VARIABLES **********************************************/
+static uint8_t g_subticks; // Ticks inside the current second
+static uint8_t g_minutes; // Minutes since the last resync
+static uint32_t g_epoch; // Seconds since 01/01/2000 (calendar.h)
+
+/** PRIVATE FUNCTION PROTOTYPES ************************************/
+static bool _resync(void);
+
+/** PRIVATE FUNCTION DEFINITIONS ***********************************/
+static bool _resync(void) {
+    uint32_t epoch = cal_ds1307_epoch(); // Shadow just read
+    bool shown = true;
+
+    // The read doesn't tell where the DS1307 second started, so the
+    // phase is kept while the seconds agree (No skipped/repeated second)
+    if (epoch == g_epoch - 1) {
+        // Ahead of the DS1307, end this second on the next tick instead
+        g_epoch = epoch;
+        g_subticks = SOFTRTC_TICKS_PER_SECOND - 1;
+        shown = false;
+    } else if (epoch != g_epoch) {
+        g_epoch = epoch; // Real correction
+        g_subticks = 0;
+    }
+    g_minutes = 0;
+    return shown;
+}
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+void softrtc_init(void) {
+    softrtc_resync();
+}
+
+bool softrtc_tick(void) {
+    if (++g_subticks < SOFTRTC_TICKS_PER_SECOND) {
+        return false;
+    }
+    g_subticks = 0;
+    g_epoch++;
+
+    if (!ds1307_advance_second()) {
+        // New day, the date is only known by the DS1307
+        softrtc_resync();
+    } else if (ds1307_get_bcd(DS1307_REG_SECONDS) == 0x00) {
+        // New minute
+        if (++g_minutes >= SOFTRTC_RESYNC_MINUTES) {
+            // The date can't change here (Not midnight), 3 bytes are enough
+            ds1307_read_time();
+            return _resync(); // The previous second is already shown
+        }
+    }
+    return true;
+}
+
+void softrtc_resync(void) {
+    ds1307_get_clock();
+    _resync();
+}
+
+void softrtc_set(bool new_second) {
+    g_epoch = cal_ds1307_epoch();
+    if (new_second) {
+        // Writing the seconds resets the DS1307 countdown chain, a new
+        // second starts now on both. Other registers keep its phase.
+        g_subticks = 0;
+    }
+    g_minutes = 0;
+}
+
+uint32_t softrtc_epoch(void) {
+    return g_epoch;
+}
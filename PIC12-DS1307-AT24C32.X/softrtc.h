@@ -0,0 +1,85 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       softrtc.h
+ * Created On:      October 19, 2026, 11:20 AM
+ * Description:     Time keeper on the PIC side. The ds1307 register
+ *                  shadow is advanced from the timer tick, so the
+ *                  ds1307_get_*() functions are RAM reads and the bus
+ *                  is used only to resynchronize.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Epoch counter
+ *                      Once per second with TICKLESS
+ * 1.2      10/19/26    softrtc_set keeps the phase unless the seconds were written
+ *********************************************************************/
+
+#ifndef __SOFTRTC_H
+#define __SOFTRTC_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/** INTERFACE CONFIGURATION ****************************************/
+#if TICKLESS
+#define SOFTRTC_TICKS_PER_SECOND    1 // Once per second, the tick is stretched in between (main.h)
+#else
+#define SOFTRTC_TICKS_PER_SECOND    TICKS_PER_SECOND // softrtc_tick() calls per second (main.h)
+#endif
+#define SOFTRTC_RESYNC_MINUTES      1  // Read the DS1307 every N minutes (1-255)
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Syncronize with the DS1307 (Call after ds1307_init)
+ */
+void softrtc_init(void);
+/**
+ * Call this function every tick (1/SOFTRTC_TICKS_PER_SECOND)
+ * @return true = the second changed
+ */
+bool softrtc_tick(void);
+/**
+ * Read the DS1307 now and correct the soft time (On demand resync)
+ */
+void softrtc_resync(void);
+/**
+ * Take the time from the ds1307 shadow (After the application changed it, no bus access)
+ * @param new_second true = the seconds register was written, a new second starts now
+ */
+void softrtc_set(bool new_second);
+/**
+ * Get the current time as epoch (calendar.h)
+ * @return Seconds since 01/01/2000
+ */
+uint32_t softrtc_epoch(void);
+
+#endif // __SOFTRTC_H
@@ -0,0 +1,265 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       tick.c
+ * Created On:      October 19, 2026, 5:30 PM
+ * Description:     Timer1 setup, tick ISR, spans and timestamps
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    tick_delay_ms
+ * 1.2      10/19/26    tick_set_span
+ * 1.3      10/19/26    tick_stamp
+ * 1.4      10/19/26    Trace ticks
+ * 1.5      10/19/26    tick_delay_ms removed, the tasks use timeouts
+ * 1.6      10/19/26    Fosc/4 span only moves the compare forward
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "tick.h"
+#include "trace.h"
+#if TIMEBASE_32KHZ
+#include "ds1307.h"
+#endif
+
+/** PRIVATE DEFINES ************************************************/
+#define TMR1_PS_1_1  0
+#define TMR1_PS_1_8  3
+
+#define CCP1_COMPARE_SPECIAL_EVENT  0b1011 // CCP1M, resets Timer1 on match
+#define TICK_SPAN_MARGIN    512 // Timer1 counts (512us) left before the compare to move it
+
+#if TIMEBASE_32KHZ
+#define TICK_MS_INT     (1000 / TICKS_PER_SECOND) // 62
+#define TICK_MS_FRAC    (1000 % TICKS_PER_SECOND) // 8/16 = .5
+#define TMR1H_32KHZ_RELOAD ((65536 - 32768 / TICKS_PER_SECOND) >> 8) // TMR1L is not touched
+#define TMR1H_PER_TICK  (32768 / TICKS_PER_SECOND / 256) // 8
+#define TMR1_PER_TICK   (32768 / TICKS_PER_SECOND) // 2048
+#endif
+
+/** PRIVATE VARIABLES **********************************************/
+static volatile uint32_t g_ms;
+static uint8_t g_span = 1; // Ticks in the current Timer1 period
+static volatile uint16_t g_stamp; // tick_stamp() at the start of the period
+#if TIMEBASE_32KHZ
+static uint8_t g_ms_frac; // 1/TICKS_PER_SECOND ms
+#else
+static uint16_t g_counts; // Timer1 counts in a tick
+static uint8_t g_max_span; // TICK_MAX_SPAN or less, the compare fits in 16b
+#endif
+
+/** PRIVATE FUNCTION DEFINITIONS ***********************************/
+static uint16_t _read_tmr1(void) {
+    uint8_t h, l;
+
+    do { // TMR1L can carry into TMR1H between the reads
+        h = TMR1H;
+        l = TMR1L;
+    } while (h != TMR1H);
+    return ((uint16_t) h << 8) | l;
+}
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+void tick_init(uint16_t counts_per_ms) {
+    T1CONbits.TMR1ON = 0; // Stop Timmer
+#if TIMEBASE_32KHZ
+    // DS1307 SQW/OUT is open drain, RA5 input with weak pull-up
+    TRISAbits.TRISA5 = 1;
+    WPUA = 0b00100000; // Pull-up only on RA5
+    OPTION_REGbits.nWPUEN = 0;
+    ds1307_set_control(DS1307_CONF_SQWE_OUT_1, DS1307_CONF_SQWE_ON, DS1307_CONF_RS_32768HZ);
+    T1CONbits.TMR1CS = 0b10; // T1CKI pin
+    T1CONbits.T1OSCEN = 0; // Not the T1 oscillator
+    T1CONbits.nT1SYNC = 1; // Asynchronous, keeps counting in sleep
+    T1CONbits.T1CKPS = TMR1_PS_1_1;
+    TMR1H = TMR1H_32KHZ_RELOAD;
+    TMR1L = 0;
+    PIR1bits.TMR1IF = 0;
+    PIE1bits.TMR1IE = 1;
+#else
+    // Timer1 counts 0 -> CCPR1 and is reset on the next count,
+    // so the period is CCPR1 + 1
+    T1CONbits.TMR1CS = 0b00; // Fosc/4
+    T1CONbits.T1CKPS = TMR1_PS_1_8;
+    TMR1H = 0;
+    TMR1L = 0;
+    g_counts = counts_per_ms * TICK_PERIOD_MS;
+    g_max_span = TICK_MAX_SPAN;
+    while ((uint32_t) g_counts * g_max_span > 0x10000UL) {
+        g_max_span--; // Tuned counts_per_ms above the nominal one
+    }
+    counts_per_ms = g_counts - 1;
+    CCPR1H = (uint8_t) (counts_per_ms >> 8);
+    CCPR1L = (uint8_t) counts_per_ms;
+    CCP1CON = CCP1_COMPARE_SPECIAL_EVENT;
+    PIR1bits.CCP1IF = 0;
+    PIE1bits.CCP1IE = 1;
+#endif
+    INTCONbits.PEIE = 1; // Timmers are peripherials
+    T1CONbits.TMR1ON = 1; // Start timer
+}
+
+uint8_t tick_isr(void) {
+    uint8_t span;
+#if TIMEBASE_32KHZ
+    uint16_t frac;
+
+    if (!PIR1bits.TMR1IF) {
+        return 0;
+    }
+    // Free running, TMR1H is 0x00 right after the overflow and TMR1L
+    // keeps the counts since then, so no tick time is lost
+    TMR1H |= TMR1H_32KHZ_RELOAD;
+    PIR1bits.TMR1IF = 0;
+    span = g_span;
+    g_span = 1;
+    g_stamp += (uint16_t) span * TMR1_PER_TICK;
+    g_ms += (uint16_t) span * TICK_MS_INT;
+    frac = g_ms_frac + (uint16_t) span * TICK_MS_FRAC;
+    while (frac >= TICKS_PER_SECOND) {
+        frac -= TICKS_PER_SECOND;
+        g_ms++;
+    }
+    g_ms_frac = (uint8_t) frac;
+#else
+    uint16_t cmp;
+
+    if (!PIR1bits.CCP1IF) {
+        return 0;
+    }
+    PIR1bits.CCP1IF = 0; // Timer1 was already reset by the CCP1
+    span = g_span;
+    g_stamp += span * g_counts;
+    if (span != 1) {
+        // Back to a single tick, Timer1 is just past 0
+        g_span = 1;
+        cmp = g_counts - 1;
+        CCPR1H = (uint8_t) (cmp >> 8);
+        CCPR1L = (uint8_t) cmp;
+    }
+    g_ms += (uint16_t) span * TICK_PERIOD_MS;
+#endif
+#if TRACE_TICKS
+    TRACE_EVENT(TRACE_EV_TICK, span);
+#endif
+    return span;
+}
+
+void tick_set_span(uint8_t ticks) {
+#if TIMEBASE_32KHZ
+    uint8_t h, elapsed;
+
+    if (PIR1bits.TMR1IF) {
+        return; // The period already ended, TMR1H is not reloaded yet
+    }
+    if (ticks > TICK_MAX_SPAN) {
+        ticks = TICK_MAX_SPAN;
+    }
+    // The period started at TMR1H = 0x100 - 8 * span, moving that start
+    // keeps the counts. Not near a TMR1L rollover so TMR1H can't
+    // increment during the read-modify-write (16 counts = 0.5ms max).
+    while (TMR1L >= 0xF0);
+    h = TMR1H;
+    elapsed = (uint8_t) (h + TMR1H_PER_TICK * g_span) / TMR1H_PER_TICK;
+    if (ticks <= elapsed) {
+        ticks = elapsed + 1;
+    }
+    TMR1H = (uint8_t) (h - TMR1H_PER_TICK * (ticks - g_span));
+#else
+    uint16_t cmp, counts;
+
+    if (PIR1bits.CCP1IF) {
+        return; // The period already ended
+    }
+    if (ticks > g_max_span) {
+        ticks = g_max_span;
+    }
+    if (ticks <= g_span) {
+        return; // Already that long, the compare is kept (Called on every idle)
+    }
+    // The new compare is after the current one, which must still be
+    // TICK_SPAN_MARGIN counts ahead of Timer1 so it's never matched while
+    // its bytes are written. Else the period ends as it is.
+    cmp = g_counts * g_span - 1;
+    counts = _read_tmr1();
+    if (PIR1bits.CCP1IF || ((uint16_t) (cmp - counts) < TICK_SPAN_MARGIN)) {
+        return; // Ended meanwhile, or too close to the end
+    }
+    cmp = g_counts * ticks - 1; // Can't wrap, g_max_span
+    CCPR1H = (uint8_t) (cmp >> 8);
+    CCPR1L = (uint8_t) cmp;
+#endif
+    g_span = ticks;
+}
+
+uint16_t tick_stamp(void) {
+    bool gie = INTCONbits.GIE;
+    uint16_t base, counts;
+
+    INTCONbits.GIE = 0; // The period and g_stamp must match
+    base = g_stamp;
+    counts = _read_tmr1();
+#if TIMEBASE_32KHZ
+    if (PIR1bits.TMR1IF) {
+        // Overflowed (Maybe after the read) and not reloaded yet,
+        // counts from 0 in the new period
+        base += (uint16_t) g_span * TMR1_PER_TICK;
+        counts = _read_tmr1();
+    } else {
+        counts += (uint16_t) g_span * TMR1_PER_TICK; // The period started at 0x10000 - span
+    }
+#else
+    if (PIR1bits.CCP1IF) {
+        // Reset by the CCP1 (Maybe after the read), counts from 0 in the new period
+        base += g_span * g_counts;
+        counts = _read_tmr1();
+    }
+#endif
+    INTCONbits.GIE = gie;
+    return base + counts;
+}
+
+uint32_t tick_ms(void) {
+    uint32_t ms;
+
+    // Read until stable, GIE can't be touched from the ISR
+    do {
+        ms = g_ms;
+    } while (ms != g_ms);
+    return ms;
+}
+
+uint32_t tick_elapsed(uint32_t since) {
+    return tick_ms() - since;
+}
+
+bool tick_timeout(uint32_t since, uint32_t timeout_ms) {
+    return (tick_elapsed(since) >= timeout_ms);
+}
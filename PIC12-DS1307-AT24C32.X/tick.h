@@ -0,0 +1,129 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       tick.h
+ * Created On:      October 19, 2026, 5:30 PM
+ * Description:     System tick and millisecond clock on Timer1.
+ *                  Fosc/4: CCP1 compare with special event trigger
+ *                  resets Timer1 in hardware, nothing to reload.
+ *                  TIMEBASE_32KHZ: free running overflow of the
+ *                  DS1307 32.768KHz, ms are added with the fraction.
+ *                  No counts are lost between periods, but the ms
+ *                  are only as accurate as the clock (INTOSC drifts
+ *                  unless tuned with osccal.h) and a tick is lost if
+ *                  the ISR runs a full tick period late: keep GIE = 0
+ *                  sections (and other ISR work) under TICK_PERIOD_MS.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    tick_delay_ms
+ *                      TICK_FROM_MS
+ * 1.2      10/19/26    Tick spans for tickless idle
+ * 1.3      10/19/26    tick_stamp
+ *                      Accuracy limits documented
+ *                      tick_delay_ms removed, the tasks use timeouts
+ *********************************************************************/
+
+#ifndef __TICK_H
+#define __TICK_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define TICK_COUNTS_PER_MS  (_XTAL_FREQ / _OSC_PER_INST / 8 / 1000) // Timer1 counts (Fosc/4, 1:8) in 1ms
+#define TICK_PERIOD_MS      1 // Fosc/4 tick (TIMEBASE_32KHZ uses 1000 / TICKS_PER_SECOND)
+#if TIMEBASE_32KHZ
+#define TICK_MAX_SPAN       (2 * TICKS_PER_SECOND) // 65536 / 32768Hz = 2s, TMR1H is 0x00
+#else
+#define TICK_MAX_SPAN       (60 / TICK_PERIOD_MS) // CCPR1 is 16b, room for a tuned counts_per_ms
+#endif
+
+// Milliseconds to ticks (Rounded, constants only)
+#if TIMEBASE_32KHZ
+#define TICK_FROM_MS(ms)    (((ms) * TICKS_PER_SECOND + 500) / 1000)
+#else
+#define TICK_FROM_MS(ms)    (((ms) + TICK_PERIOD_MS / 2) / TICK_PERIOD_MS)
+#endif
+
+// Microseconds to tick_stamp() counts (Constants only)
+#if TIMEBASE_32KHZ
+#define TICK_STAMP_FROM_US(us)  ((uint16_t) ((us) * 32768UL / 1000000))
+#else
+#define TICK_STAMP_FROM_US(us)  ((uint16_t) ((us) * TICK_COUNTS_PER_MS / 1000))
+#endif
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Configure and start Timer1 and its interrupt (GIE is not changed)
+ * @param counts_per_ms Timer1 counts in 1ms, TICK_COUNTS_PER_MS or measured (Not used with TIMEBASE_32KHZ)
+ */
+void tick_init(uint16_t counts_per_ms);
+/**
+ * Call this function from the ISR
+ * @return Ticks in the period that ended, 0 = no tick (Flag is cleared)
+ */
+uint8_t tick_isr(void);
+/**
+ * Stretch the current Timer1 period to end N ticks after it started, the
+ * next one is a single tick again. With Fosc/4 it's only lengthened, and
+ * kept when the period ends in less than 512us. With TIMEBASE_32KHZ it's
+ * not shortened below the ticks already elapsed. Call with GIE = 0.
+ * @param ticks 1 -> TICK_MAX_SPAN
+ */
+void tick_set_span(uint8_t ticks);
+/**
+ * Get the milliseconds since tick_init (ISR and main loop safe)
+ * @return Milliseconds (Wraps after 49 days)
+ */
+uint32_t tick_ms(void);
+/**
+ * Free running 16b timestamp in Timer1 counts, 1us with Fosc/4 and
+ * TICK_COUNTS_PER_MS (30.5us with TIMEBASE_32KHZ). ISR and main loop safe.
+ * @return Counts, differences are valid up to 65535 counts (Wrap safe)
+ */
+uint16_t tick_stamp(void);
+/**
+ * Milliseconds since a tick_ms() value (Wrap safe)
+ * @param since Previous tick_ms()
+ * @return Milliseconds
+ */
+uint32_t tick_elapsed(uint32_t since);
+/**
+ * Check a timeout started at a tick_ms() value (Wrap safe)
+ * @param since Previous tick_ms()
+ * @param timeout_ms Timeout in milliseconds
+ * @return true = expired
+ */
+bool tick_timeout(uint32_t since, uint32_t timeout_ms);
+
+#endif // __TICK_H
@@ -0,0 +1,128 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       trace.c
+ * Created On:      October 19, 2026, 10:00 PM
+ * Description:     Persistent ring buffer and binary dump
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Dump in parts, GIE is restored
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "trace.h"
+#include "tick.h"
+
+#if TRACE
+/** PRIVATE DEFINES ************************************************/
+#define TRACE_MAGIC     0x5A // The persistent variables are valid
+#define TRACE_DUMP_ID   'T'
+
+/** PRIVATE VARIABLES **********************************************/
+typedef struct {
+    uint8_t event;
+    uint8_t arg;
+    uint16_t ms;
+} trace_rec_t;
+
+// Not cleared by the startup code
+static persistent trace_rec_t g_rec[TRACE_RECORDS];
+static persistent uint8_t g_head; // Next record to write
+static persistent uint8_t g_count; // Valid records
+static persistent uint8_t g_magic;
+static uint8_t g_dump_count; // Records in the dump being sent
+static uint8_t g_dump_next; // Next record to send
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+void trace_init(void) {
+    if ((g_magic != TRACE_MAGIC) || (g_head >= TRACE_RECORDS) || (g_count > TRACE_RECORDS)) {
+        trace_clear(); // Power up, RAM is random
+    }
+    trace_event(TRACE_EV_RESET, 0);
+}
+
+void trace_event(uint8_t event, uint8_t arg) {
+    uint16_t ms = (uint16_t) tick_ms();
+    bool gie = INTCONbits.GIE;
+    trace_rec_t* p_rec;
+
+    INTCONbits.GIE = 0; // The ISR adds records too
+    p_rec = &g_rec[g_head];
+    g_head = (g_head + 1) & (TRACE_RECORDS - 1);
+    if (g_count < TRACE_RECORDS) {
+        g_count++;
+    }
+    p_rec->event = event;
+    p_rec->arg = arg;
+    p_rec->ms = ms;
+    INTCONbits.GIE = gie;
+}
+
+void trace_clear(void) {
+    bool gie = INTCONbits.GIE;
+
+    INTCONbits.GIE = 0;
+    g_head = 0;
+    g_count = 0;
+    g_magic = TRACE_MAGIC;
+    INTCONbits.GIE = gie;
+}
+
+uint8_t trace_dump_next(uint8_t* p_part, uint8_t* p_buf) {
+    trace_rec_t rec;
+    bool gie = INTCONbits.GIE;
+
+    if (*p_part == 0) {
+        INTCONbits.GIE = 0;
+        g_dump_count = g_count;
+        g_dump_next = (g_head - g_count) & (TRACE_RECORDS - 1); // Oldest
+        INTCONbits.GIE = gie;
+        p_buf[0] = TRACE_DUMP_ID;
+        p_buf[1] = g_dump_count;
+        *p_part = 1;
+        return 2;
+    }
+    if (*p_part > g_dump_count) {
+        return 0;
+    }
+    INTCONbits.GIE = 0; // Can be overwritten meanwhile, but not half written
+    rec = g_rec[g_dump_next];
+    INTCONbits.GIE = gie;
+    g_dump_next = (g_dump_next + 1) & (TRACE_RECORDS - 1);
+    (*p_part)++;
+    p_buf[0] = rec.event;
+    p_buf[1] = rec.arg;
+    p_buf[2] = (uint8_t) rec.ms;
+    p_buf[3] = (uint8_t) (rec.ms >> 8);
+    return TRACE_PART_SIZE;
+}
+#endif // TRACE
@@ -0,0 +1,99 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       trace.h
+ * Created On:      October 19, 2026, 10:00 PM
+ * Description:     Event trace in a RAM ring buffer (TRACE in main.h).
+ *                  The buffer is persistent, it's kept over a reset
+ *                  without power loss and marked by a TRACE_EV_RESET.
+ *                  Record[4] = |EVENT|ARG|MS<7:0>|MS<15:8>| (tick_ms())
+ *                  Dump = |'T'|COUNT|Record oldest|...|Record newest|
+ *                  The COUNT records are the ones at the dump start.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    Dump in parts, GIE is restored
+ *********************************************************************/
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define TRACE_RECORDS   16 // Power of 2, 4 bytes of RAM each
+#define TRACE_TICKS     0  // 1 = Trace every tick too (Fills the buffer)
+#define TRACE_PART_SIZE 4  // Buffer of trace_dump_next(), a record
+
+// Events, ARG
+#define TRACE_EV_RESET      0x01 // trace_init(), 0
+#define TRACE_EV_I2C_START  0x10 // Address byte with R/W
+#define TRACE_EV_I2C_STOP   0x11 // 0
+#define TRACE_EV_I2C_NACK   0x12 // Byte not acknowledged
+#define TRACE_EV_TICK       0x20 // Ticks in the period
+#define TRACE_EV_KEY        0x30 // Valid key (keypad.h)
+#define TRACE_EV_TASK_ENTER 0x40 // Task id (sched.h)
+#define TRACE_EV_TASK_EXIT  0x41 // Task id
+#define TRACE_EV_USER       0x80 // 0x80 -> 0xFF for the application
+
+#if TRACE
+#define TRACE_EVENT(ev, arg)    trace_event((ev), (arg))
+#else
+#define TRACE_EVENT(ev, arg)
+#endif
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Keep the records of before a reset if they are valid, else clear them
+ */
+void trace_init(void);
+/**
+ * Add a record, the oldest one is lost when full (ISR and main loop safe)
+ * @param event TRACE_EV_*
+ * @param arg Event argument
+ */
+void trace_event(uint8_t event, uint8_t arg);
+/**
+ * Remove all the records
+ */
+void trace_clear(void);
+/**
+ * Get the next part of the dump for the host decoder, so it's sent in
+ * chunks without waiting: |'T'|COUNT| first, then one record each (Main loop)
+ * @param p_part Pointer to the part number, set to 0 to start a dump
+ * @param p_buf Pointer to buffer[TRACE_PART_SIZE]
+ * @return Bytes in the buffer, 0 = the dump is complete
+ */
+uint8_t trace_dump_next(uint8_t* p_part, uint8_t* p_buf);
+
+#endif // __TRACE_H
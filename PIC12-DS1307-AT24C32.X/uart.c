@@ -0,0 +1,149 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       uart.c
+ * Created On:      October 19, 2026, 11:00 PM
+ * Description:     EUSART setup, ring buffers and the RX/TX ISR
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    uart_tx_free() instead of the blocking uart_putc()
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "uart.h"
+
+/** PRIVATE DEFINES ************************************************/
+// BRG16 = 1, BRGH = 1: Baud = Fosc / (4 * (SPBRG + 1)), rounded
+#define UART_SPBRG  ((_XTAL_FREQ + 2 * UART_BAUD) / (4 * UART_BAUD) - 1)
+
+/** PRIVATE VARIABLES **********************************************/
+// Only the main loop moves the heads and only the ISR the tails,
+// each index is a byte so no GIE is needed
+static uint8_t g_tx[UART_TX_SIZE];
+static volatile uint8_t g_tx_head; // Next byte to write
+static volatile uint8_t g_tx_tail; // Next byte to send
+#if UART_RX_SIZE > 0
+static uint8_t g_rx[UART_RX_SIZE];
+static volatile uint8_t g_rx_head; // Next byte to store (ISR)
+static volatile uint8_t g_rx_tail; // Next byte to read
+#endif
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+void uart_init(void) {
+    SPBRGH = (uint8_t) (UART_SPBRG >> 8);
+    SPBRGL = (uint8_t) UART_SPBRG;
+    BAUDCONbits.BRG16 = 1;
+    TXSTAbits.BRGH = 1;
+    TXSTAbits.SYNC = 0; // Asynchronous
+    ANSELAbits.ANSA0 = 0; // TX on RA0, digital output
+    TRISAbits.TRISA0 = 0;
+#if UART_RX_SIZE > 0
+    APFCONbits.RXDTSEL = 1; // RX on RA5
+    TRISAbits.TRISA5 = 1;
+    RCSTAbits.CREN = 1;
+    PIE1bits.RCIE = 1;
+#endif
+    RCSTAbits.SPEN = 1; // Serial port on
+    TXSTAbits.TXEN = 1; // TXIF is set, TXIE only while the ring has data
+    INTCONbits.PEIE = 1;
+}
+
+bool uart_isr(void) {
+    bool received = false;
+
+#if UART_RX_SIZE > 0
+    if (PIR1bits.RCIF) {
+        uint8_t next = (g_rx_head + 1) & (UART_RX_SIZE - 1);
+
+        if (RCSTAbits.OERR) {
+            RCSTAbits.CREN = 0; // Overrun stops the receiver, restart it
+            RCSTAbits.CREN = 1;
+        }
+        if (next != g_rx_tail) {
+            g_rx[g_rx_head] = RCREG;
+            g_rx_head = next;
+            received = true;
+        } else {
+            (void) RCREG; // Full, lost
+        }
+    }
+#endif
+    if (PIE1bits.TXIE && PIR1bits.TXIF) {
+        if (g_tx_tail != g_tx_head) {
+            TXREG = g_tx[g_tx_tail];
+            g_tx_tail = (g_tx_tail + 1) & (UART_TX_SIZE - 1);
+        }
+        if (g_tx_tail == g_tx_head) {
+            PIE1bits.TXIE = 0; // Empty, uart_write() enables it again
+        }
+    }
+    return received;
+}
+
+uint8_t uart_write(const uint8_t* p_data, uint8_t len) {
+    uint8_t n = 0;
+    uint8_t next;
+
+    while (n < len) {
+        next = (g_tx_head + 1) & (UART_TX_SIZE - 1);
+        if (next == g_tx_tail) {
+            break; // Full
+        }
+        g_tx[g_tx_head] = p_data[n++];
+        g_tx_head = next;
+    }
+    if (n != 0) {
+        PIE1bits.TXIE = 1; // Single bit set, safe against the ISR clear
+    }
+    return n;
+}
+
+uint8_t uart_tx_free(void) {
+    return (g_tx_tail - g_tx_head - 1) & (UART_TX_SIZE - 1); // One is always free
+}
+
+bool uart_getc(uint8_t* p_c) {
+#if UART_RX_SIZE > 0
+    if (g_rx_tail == g_rx_head) {
+        return false;
+    }
+    *p_c = g_rx[g_rx_tail];
+    g_rx_tail = (g_rx_tail + 1) & (UART_RX_SIZE - 1);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool uart_is_idle(void) {
+    return (g_tx_tail == g_tx_head) && TXSTAbits.TRMT;
+}
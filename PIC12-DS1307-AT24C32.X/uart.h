@@ -0,0 +1,94 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       uart.h
+ * Created On:      October 19, 2026, 11:00 PM
+ * Description:     EUSART 8N1 with interrupt driven TX/RX rings.
+ *                  TX -> RA0, RX <- RA5 (APFCON.RXDTSEL, RA1 is SCL).
+ *                  RA5 is T1CKI with TIMEBASE_32KHZ, then only TX.
+ *                  The EUSART stops in sleep, see uart_is_idle().
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version
+ * 1.1      10/19/26    uart_tx_free() instead of the blocking uart_putc()
+ *********************************************************************/
+
+#ifndef __UART_H
+#define __UART_H
+
+/** INCLUDES *******************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+/** INTERFACE CONFIGURATION ****************************************/
+#define UART_BAUD       115200UL // 32MHz: 115942 (+0.6%), up to 500000 without error
+#define UART_TX_SIZE    32 // Power of 2
+#if TIMEBASE_32KHZ
+#define UART_RX_SIZE    0  // RA5 is T1CKI
+#else
+#define UART_RX_SIZE    8  // Power of 2, 0 = TX only
+#endif
+
+/** PUBLIC FUNCTIONS ***********************************************/
+/**
+ * Configure the EUSART and its interrupts (GIE is not changed)
+ */
+void uart_init(void);
+/**
+ * Call this function from the ISR
+ * @return true = a byte was received
+ */
+bool uart_isr(void);
+/**
+ * Queue bytes without waiting
+ * @param p_data Bytes to send
+ * @param len Number of bytes
+ * @return Bytes queued, less than len if the ring is full
+ */
+uint8_t uart_write(const uint8_t* p_data, uint8_t len);
+/**
+ * Get the room in the TX ring, to queue a whole record at once
+ * @return Bytes that uart_write() can queue now
+ */
+uint8_t uart_tx_free(void);
+/**
+ * Get a received byte without waiting
+ * @param p_c Pointer to the byte
+ * @return true = a byte was read, false = nothing received
+ */
+bool uart_getc(uint8_t* p_c);
+/**
+ * Check that nothing is being sent (Before sleep)
+ * @return true = TX ring and shift register are empty
+ */
+bool uart_is_idle(void);
+
+#endif // __UART_H
@@ -0,0 +1,59 @@
+/*
+ *	Copyright (c) 2026, http://www.proprojects.wordpress.com
+ *	All rights reserved.
+ *
+ * 	Redistribution and use in source and binary forms, with or without modification,
+ *	are permitted provided that the following conditions are met:
+ *
+ *	1.- Redistributions of source code must retain the above copyright notice,
+ *          this list of conditions and the following disclaimer.
+ *	2.- Redistributions in binary form must reproduce the above copyright notice,
+ *          this list of conditions and the following disclaimer in the documentation
+ *          and/or other materials provided with the distribution.
+ *
+ *	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+ *	EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *	OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ *	IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ *	INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *	LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *	OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *	CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *	WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*********************************************************************
+ * By:              PIC12F1840 project contributors
+ * Company:         http://proprojects.wordpress.com
+ * Processor:       PIC12
+ * Compiler:        XC8 v1.32
+ * File Name:       pic12f1840_delay.c
+ * Created On:      October 19, 2026, 7:10 PM
+ * Description:     Timer2 1ms period polling
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Rev.     Date        Comment
+ * 1.0      10/19/26    Initial version, from main.c
+ *********************************************************************/
+
+/** INCLUDES *******************************************************/
+#include "pic12f1840_delay.h"
+#include "main.h"
+
+/** PRIVATE DEFINES ************************************************/
+#define DELAY_PR2   ((_XTAL_FREQ / _OSC_PER_INST / 64 / 1000) - 1) // Timer2 1ms period (1:64)
+
+/** PUBLIC FUNCTION DEFINITIONS ************************************/
+void delay_ms(uint16_t t_ms) {
+    // Timer2 period = Fosc/4 / 64 / (PR2 + 1) = 1ms
+    T2CONbits.TMR2ON = 0;
+    T2CONbits.T2CKPS = 0b11; // 1:64
+    T2CONbits.T2OUTPS = 0b0000; // 1:1
+    PR2 = DELAY_PR2;
+    TMR2 = 0;
+    PIR1bits.TMR2IF = 0;
+    T2CONbits.TMR2ON = 1;
+    for (; t_ms > 0; t_ms--) {
+        while (!PIR1bits.TMR2IF); // Wait 1ms
+        PIR1bits.TMR2IF = 0;
+    }
+    T2CONbits.TMR2ON = 0;
+}